@@ -33,14 +33,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrameTypes.h>
 #include <DataFrame/Utils/DateTime.h>
 #include <DataFrame/Utils/AlignedAllocator.h>
+#include <DataFrame/Utils/DerivedCache.h>
 #include <DataFrame/Utils/FixedSizeString.h>
 #include <DataFrame/Utils/ThreadGranularity.h>
 #include <DataFrame/Utils/Utils.h>
 
+#include <array>
 #include <functional>
 #include <future>
 #include <ios>
 #include <limits>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -119,6 +122,11 @@ public:  // Construction
                            T,
                            std::size_t(H::align_value)>::type>;
 
+    // (lhs row, rhs row) pairs of a join. If a row has no match, the other
+    // side is std::numeric_limits<size_type>::max()
+    //
+    using JoinRowsVec = StlVecType<std::tuple<size_type, size_type>>;
+
     DataFrame() = default;
 
     // Because of thread safety, these need tender loving care
@@ -135,6 +143,8 @@ public:  // Load/append/remove interfaces
     // multi-threaded program, you must provide a SpinLock. DataFrame will use
     // your SpinLock to protect its static data.
     // This is done this way, so by default, there is no locking overhead.
+    // The static data is shared by all DataFrames, so they must all use the
+    // same SpinLock. SpinLock::get_stats() tells you what the lock costs.
     //
     static void
     set_lock (SpinLock *sl);
@@ -459,14 +469,108 @@ public:  // Load/append/remove interfaces
     //
     // NOTE: This is not the most efficient way of appending values to columns
     //       in a rapid way, for example in a real-time system.
-    //       For the most efficient way of appending to columns, maintain a
-    //       reference to column vectors – by calling get_column() –
-    //       and simply use push_back().
+    //       For the most efficient way of appending to columns, use an
+    //       Appender. See get_appender() below.
     //
     template<typename ... Ts>
     size_type
     append_row(IndexType *idx_val, Ts&& ... args);
 
+    // An Appender appends rows to a fixed set of columns and the index.
+    // The columns are looked up once, when the Appender is made by
+    // get_appender(). After that, a row is a push_back() to each vector.
+    // Capacity is reserved for all the vectors together, in blocks.
+    //
+    // The derived cache and the subscribed visitors are told about the
+    // appended rows by flush(), which is also called by the destructor.
+    //
+    // NOTE: Like references returned by get_column(), an Appender is
+    //       invalidated if a column is added to or removed from the
+    //       DataFrame.
+    //
+    // Ts:
+    //   The list of types for the bound columns, in order
+    //
+    template<typename ... Ts>
+    class   Appender  {
+
+    public:
+
+        Appender() = delete;
+        Appender(const Appender &) = delete;
+        Appender &operator= (const Appender &) = delete;
+        Appender &operator= (Appender &&) = delete;
+
+        Appender(Appender &&that) noexcept;
+        ~Appender();
+
+        // It appends one row
+        //
+        // idx_val:
+        //   Index value of the row
+        // vals:
+        //   Values of the bound columns, in order
+        //
+        void
+        append(const IndexType &idx_val, const Ts & ... vals);
+
+        // It appends n rows from arrays
+        //
+        // n:
+        //   Number of rows
+        // idx_vals:
+        //   Pointer to n index values
+        // vals:
+        //   Pointers to n values for each of the bound columns, in order
+        //
+        void
+        append(size_type n, const IndexType *idx_vals, const Ts * ... vals);
+
+        // It reserves room for n more rows in the index and bound columns
+        //
+        void
+        reserve(size_type n);
+
+        // It tells the derived cache and the subscribed visitors about the
+        // rows appended since the last flush. It returns the number of
+        // those rows
+        //
+        size_type
+        flush();
+
+    private:
+
+        friend class    DataFrame;
+
+        using ColumnPtrs = std::tuple<ColumnVecType<Ts> * ...>;
+
+        Appender(DataFrame &df, ColumnPtrs &&cols, size_type block_size);
+
+        void grow_(size_type n);
+
+        DataFrame       *df_;
+        ColumnPtrs      columns_;
+        size_type       block_size_;
+        size_type       pending_ { 0 };  // Rows appended since flush()
+    };
+
+    // It returns an Appender bound to the named columns. A column that
+    // does not exist is created. A column that is shorter than the index
+    // is padded with NaN, so the appended rows line up with the index.
+    //
+    // Ts:
+    //   The list of types for the named columns, in order
+    // col_names:
+    //   Names of the columns
+    // block_size:
+    //   Minimum number of rows to reserve room for, when the index runs
+    //   out of capacity
+    //
+    template<typename ... Ts>
+    Appender<Ts ...>
+    get_appender(const std::array<const char *, sizeof...(Ts)> &col_names,
+                 size_type block_size = 4096);
+
     // It removes the data rows from index begin to index end.
     // DataFrame must be sorted by index or behavior is undefined.
     // This function first calls make_consistent() that may add nan values to
@@ -511,6 +615,8 @@ public:  // Load/append/remove interfaces
     //       column(s) will _not_ be padded with NaN's. You can always call
     //       make_consistent() afterwards to make all columns into consistent
     //       length
+    // NOTE: If thread level is set, sel_functor may be called from many
+    //       threads at once (See get_data_by_sel())
     //
     // T:
     //   Type of the named column
@@ -1104,8 +1210,14 @@ public:  // Data manipulation
     // If the named column is other than index column, then the returned
     // DataFrame also has a column with the same name which has the unique
     // values of the named column.
+    // If the named column is already sorted, the sort is skipped and the
+    // groups are aggregated in one sequential pass.
+    // If thread level is set (see ThreadGranularity), the aggregations
+    // specified by the triples run in parallel.
     // Also see bucketize().
     //
+    // NOTE: Each triple must have a distinct new column name
+    //
     // T:
     //   Type of groupby column. In case if index, it is type of index
     // I_V:
@@ -1181,6 +1293,38 @@ public:  // Data manipulation
              I_V &&idx_visitor,
              Ts&& ... args) const;
 
+    // This is the same as groupby1() above, but it is a hint that the named
+    // column is already clustered. That means all equal values are
+    // contiguous, e.g. the column is sorted or it is a bucket/session key in a
+    // time-ordered DataFrame.
+    // Each run of equal values is aggregated directly in one sequential pass.
+    // No sorting permutation is allocated.
+    // The groups in the result appear in the same order as their runs in
+    // self. If the named column is not clustered, a value appears in the
+    // result once per run.
+    //
+    // NOTE: groupby1() already detects a sorted column. Use this when the
+    //       column is clustered, but not sorted.
+    //
+    // T:
+    //   Type of groupby column. In case if index, it is type of index
+    // I_V:
+    //   Type of visitor to be used to summarize the index column
+    // Ts:
+    //   Types of triples to specify the column summarization
+    // col_name:
+    //   Name of the grouop-by'ing column
+    // idx_visitor:
+    //   A visitor to specify the index summarization
+    // args:
+    //   List of triples to specify the column summarization
+    //
+    template<typename T, typename I_V, typename ... Ts>
+    [[nodiscard]] DataFrame
+    groupby1_clustered(const char *col_name,
+                       I_V &&idx_visitor,
+                       Ts&& ... args) const;
+
     // Same as groupby1() above, but executed asynchronously
     //
     template<typename T, typename I_V, typename ... Ts>
@@ -1326,10 +1470,16 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // join_algorithm:
+    //   Specifies how to match the keys. The default sorts both sides. Hash
+    //   join avoids the sorts and is faster for large unsorted inputs.
+    //   (See join_algorithm definition)
     //
     template<typename RHS_T, typename ... Ts>
     [[nodiscard]] DataFrame<I, H>
-    join_by_index(const RHS_T &rhs, join_policy jp) const;
+    join_by_index(const RHS_T &rhs,
+                  join_policy jp,
+                  join_algorithm ja = join_algorithm::sort_merge) const;
 
     // It joins the data between self (lhs) and rhs and returns the joined data
     // in a StdDataFrame, based on specification in join_policy.
@@ -1359,10 +1509,246 @@ public:  // Data manipulation
     // join_policy:
     //   Specifies how to join. For example inner join, or left join, etc.
     //   (See join_policy definition)
+    // join_algorithm:
+    //   Specifies how to match the keys (See join_algorithm definition)
     //
     template<typename RHS_T, typename T, typename ... Ts>
     [[nodiscard]] DataFrame<unsigned int, H>
-    join_by_column(const RHS_T &rhs, const char *name, join_policy jp) const;
+    join_by_column(const RHS_T &rhs,
+                   const char *name,
+                   join_policy jp,
+                   join_algorithm ja = join_algorithm::sort_merge) const;
+
+    // Same as join_by_column() above, but it joins on two or three columns.
+    // Rows are joined when all the named columns are equal. The key columns
+    // may have different types, and they are compared as a tuple without
+    // combining them into one column. All the join policies and algorithms
+    // are supported. All the named columns are unified in the result, like
+    // the single named column above.
+    //
+    // T1, T2, T3:
+    //   Types of the named columns, in order
+    // name1, name2, name3:
+    //   Names of the columns which the join will be based on
+    //
+    template<typename RHS_T, typename T1, typename T2, typename ... Ts>
+    [[nodiscard]] DataFrame<unsigned int, H>
+    join_by_column(const RHS_T &rhs,
+                   const char *name1,
+                   const char *name2,
+                   join_policy jp,
+                   join_algorithm ja = join_algorithm::sort_merge) const;
+
+    template<typename RHS_T, typename T1, typename T2, typename T3,
+             typename ... Ts>
+    [[nodiscard]] DataFrame<unsigned int, H>
+    join_by_column(const RHS_T &rhs,
+                   const char *name1,
+                   const char *name2,
+                   const char *name3,
+                   join_policy jp,
+                   join_algorithm ja = join_algorithm::sort_merge) const;
+
+    // It joins each row of self (lhs) with the rhs row that has the nearest
+    // preceding (or following, or nearest) index, according to asof_policy.
+    // This is what you need to align trades with their prevailing quotes.
+    // The result has all the lhs rows in order, indexed by the lhs index.
+    // The rhs columns have nan where there was no match.
+    // Columns with the same name in both are named lhs.<name> and rhs.<name>
+    // like join_by_index().
+    // Both indices must be sorted in ascending order. Otherwise NotFeasible
+    // is thrown. The join is a single linear pass over the two indices.
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // rhs:
+    //   The rhs DataFrame
+    // ap:
+    //   Specifies which rhs row to match (See asof_policy definition)
+    // tolerance:
+    //   If the distance between the two indices is more than tolerance, the
+    //   row is left unmatched. For DateTime indices, it is in seconds.
+    //   The distance is the difference of the indices as double. For index
+    //   types without one, such as std::string, only the backward and
+    //   forward policies with no tolerance are allowed. Otherwise
+    //   NotFeasible is thrown
+    //
+    template<typename RHS_T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, H>
+    join_asof(const RHS_T &rhs,
+              asof_policy ap = asof_policy::backward,
+              double tolerance = std::numeric_limits<double>::max()) const;
+
+    // Same as join_asof() above, but lhs rows only match rhs rows that have
+    // the same value in the named "by" column, for example the same symbol.
+    // The by column appears once in the result, with the lhs values.
+    //
+    // T:
+    //   Type of the by column
+    // by_name:
+    //   Name of the by column. It must exist in both lhs and rhs
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, H>
+    join_asof(const RHS_T &rhs,
+              const char *by_name,
+              asof_policy ap = asof_policy::backward,
+              double tolerance = std::numeric_limits<double>::max()) const;
+
+    // Same as join_by_index() above, but it only returns the matched
+    // (lhs row, rhs row) pairs. No column is copied. You can use the pairs
+    // to gather only the columns you need with gather_join_columns().
+    // The pairs are in the same order as the rows of join_by_index() result.
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // rhs:
+    //   The rhs DataFrame
+    // jp:
+    //   Specifies how to join. For more info, see join_policy definition
+    // ja:
+    //   Specifies the join algorithm (See join_algorithm definition)
+    //
+    template<typename RHS_T>
+    [[nodiscard]] JoinRowsVec
+    join_by_index_rows(const RHS_T &rhs,
+                       join_policy jp,
+                       join_algorithm ja = join_algorithm::sort_merge) const;
+
+    // Same as join_by_column() above, but it only returns the matched
+    // (lhs row, rhs row) pairs. No column is copied.
+    //
+    // T:
+    //   Type of the named column
+    // name:
+    //   Name of the column on which the join will be done
+    //
+    template<typename RHS_T, typename T>
+    [[nodiscard]] JoinRowsVec
+    join_by_column_rows(const RHS_T &rhs,
+                        const char *name,
+                        join_policy jp,
+                        join_algorithm ja = join_algorithm::sort_merge) const;
+
+    // It materializes only the named columns of a join, given the row pairs
+    // returned by join_by_index_rows() or join_by_column_rows(). The columns
+    // are gathered in parallel, if threads are available.
+    // The result is indexed by the lhs index, or the rhs index where the lhs
+    // row is missing. A column named in both lists becomes lhs.<name> and
+    // rhs.<name>. Missing rows are nan.
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // rhs:
+    //   The rhs DataFrame
+    // join_rows:
+    //   (lhs row, rhs row) pairs of the join
+    // lhs_col_names:
+    //   Names of the lhs columns to gather
+    // rhs_col_names:
+    //   Names of the rhs columns to gather
+    //
+    template<typename RHS_T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+    gather_join_columns(const RHS_T &rhs,
+                        const JoinRowsVec &join_rows,
+                        const StlVecType<const char *> &lhs_col_names,
+                        const StlVecType<const char *> &rhs_col_names) const;
+
+    // It joins each row of self (lhs) with every rhs row whose interval
+    // [begin, end) contains the lhs point. For example, you can join orders
+    // to the trading sessions they fall into. An lhs row is repeated once
+    // for each interval that contains it, in rhs row order. The result is
+    // indexed by the lhs index.
+    // The rhs intervals are sorted by begin and the lhs points are swept in
+    // ascending order, so the join is O((n + m) log m) instead of O(n * m).
+    // Columns with the same name in both are named lhs.<name> and rhs.<name>
+    // like join_by_index().
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // T:
+    //   Type of the point, begin, and end columns
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // rhs:
+    //   The rhs DataFrame
+    // point_name:
+    //   Name of the lhs point column or "INDEX". If it is "INDEX", T must be
+    //   IndexType
+    // begin_name:
+    //   Name of the rhs column with the inclusive interval beginnings
+    // end_name:
+    //   Name of the rhs column with the exclusive interval ends
+    // jp:
+    //   inner_join or left_join. With left_join, lhs rows that are in no
+    //   interval, or past the end of the point column, are kept with nan for
+    //   the rhs columns. Other policies throw NotFeasible
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] DataFrame<I, H>
+    join_by_interval(const RHS_T &rhs,
+                     const char *point_name,
+                     const char *begin_name,
+                     const char *end_name,
+                     join_policy jp = join_policy::inner_join) const;
+
+    // It returns the rows of self (lhs) whose value in the named column also
+    // exists in the same named column of rhs. If name is "INDEX" (or
+    // DF_INDEX_COL_NAME), the indices are compared and T must be IndexType.
+    // Only the lhs columns are in the result, and rhs columns are never
+    // gathered. The rhs keys are put in a hash set, or in a sorted vector if
+    // T is not hashable. Each lhs row is returned at most once, in order.
+    //
+    // RHS_T:
+    //   Type of DataFrame rhs
+    // T:
+    //   Type of the named column
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // rhs:
+    //   The rhs DataFrame
+    // name:
+    //   Name of the column or "INDEX"
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] DataFrame
+    semi_join(const RHS_T &rhs, const char *name) const;
+
+    // Same as semi_join() above, but it returns a view
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] PtrView
+    semi_join_view(const RHS_T &rhs, const char *name);
+
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] ConstPtrView
+    semi_join_view(const RHS_T &rhs, const char *name) const;
+
+    // Same as semi_join() above, but it returns the rows of self whose value
+    // in the named column does _not_ exist in rhs
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] DataFrame
+    anti_join(const RHS_T &rhs, const char *name) const;
+
+    // Same as anti_join() above, but it returns a view
+    //
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] PtrView
+    anti_join_view(const RHS_T &rhs, const char *name);
+
+    template<typename RHS_T, typename T, typename ... Ts>
+    [[nodiscard]] ConstPtrView
+    anti_join_view(const RHS_T &rhs, const char *name) const;
 
     // It concatenates rhs to the end of self and returns the result as
     // another DataFrame.
@@ -1835,6 +2221,11 @@ public: // Read/access and slicing interfaces
     //       empty columns will _not_ be padded with NaN's. You can always
     //       call make_consistent() on the original or result DataFrame to make
     //       all columns into consistent length
+    // NOTE: If thread level is set, large selections call sel_functor from
+    //       many threads at once, and the columns are gathered in parallel.
+    //       So sel_functor must not keep mutable state. This applies to all
+    //       get_data_by_sel() and remove_data_by_sel() overloads with up to
+    //       five columns
     //
     // T:
     //   Type of the named column
@@ -2205,6 +2596,66 @@ public: // Read/access and slicing interfaces
                     const char *name5,
                     F &sel_functor) const;
 
+    // It selects rows by a predicate built from sel_col() comparisons,
+    // between(), in(), and where(), combined with &&, ||, and !
+    // (See SelCompare in DataFrameTypes.h). For example:
+    //     auto pred = sel_col<double>("price") > 10.5 &&
+    //                 sel_col<long>("volume") >= 1000;
+    //     auto res = df.get_data_by_pred<decltype(pred), double, long>(pred);
+    // Each comparison is evaluated over its whole column into a bitmap, in
+    // a branch-free loop that the compiler can vectorize. The bitmaps are
+    // combined a word at a time. If thread level is set, large columns are
+    // evaluated in parallel chunks. Functors in where() are called per row
+    // and must be safe to call from many threads at once.
+    //
+    // P:
+    //   Type of the predicate
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    // pred:
+    //   The predicate
+    //
+    template<typename P, typename ... Ts>
+    [[nodiscard]] DataFrame
+    get_data_by_pred(const P &pred) const;
+
+    // Same as get_data_by_pred() above, but it returns a view
+    //
+    template<typename P, typename ... Ts>
+    [[nodiscard]] PtrView
+    get_view_by_pred(const P &pred);
+
+    template<typename P, typename ... Ts>
+    [[nodiscard]] ConstPtrView
+    get_view_by_pred(const P &pred) const;
+
+    // It returns the number of rows that satisfy pred, without selecting
+    // them (See get_data_by_pred())
+    //
+    template<typename P>
+    [[nodiscard]] size_type
+    count_by_pred(const P &pred) const;
+
+    // It returns a lazy query over this DataFrame. The filters, column
+    // selection, and groupby steps are recorded and only run, fused, when
+    // the query is collected. Only the columns the query needs are copied,
+    // once (See DataFrame_query.h). For example:
+    //     auto res = df.query()
+    //                  .where(sel_col<double>("price") > 10.5)
+    //                  .groupby<std::string>(
+    //                      "symbol",
+    //                      LastVisitor<IndexType, IndexType>(),
+    //                      std::make_tuple("price", "avg_price",
+    //                                      MeanVisitor<double>()))
+    //                  .collect<double, std::string>();
+    // It works the same way on a view.
+    //
+#   include <DataFrame/Internals/DataFrame_query.h>
+
+    [[nodiscard]] Query
+    query() const;
+
     // Data by select for larger number of columns
     //
     template<typename T1, typename T2, typename T3, typename T4, typename T5,
@@ -2531,6 +2982,10 @@ public: // Read/access and slicing interfaces
     //  -- 25% quantile item in the column
     //  -- 50% quantile item in the column
     //  -- 75% quantile item in the column
+    // Missing items are left out of all statistics but the first two.
+    // Each column is read in one pass, with the variance computed by
+    // Welford's method. The quantiles are selected from one copy of the
+    // column. If thread level is set, the columns are described in parallel.
     //
     // Ts:
     //   List all the types of all data columns. A type should be specified in
@@ -2883,6 +3338,24 @@ public:  // Visitors
     void
     multi_visit(Ts ... args) const;
 
+    // Same as multi_visit() above, but the pairs are grouped by column
+    // name. Each column is read once, a block at a time, and every block is
+    // passed to all the visitors of that column while it is still in cache.
+    // If thread level is set, the columns are visited in parallel.
+    // The result is the same as multi_visit(). Asking for Mean, StdDev, Min,
+    // and Max of one column scans it once, instead of four times.
+    //
+    // NOTE: Visitors of different columns may run in different threads at
+    //       the same time. A visitor object should not be passed twice.
+    //
+    template<typename ... Ts>
+    void
+    multi_visit_fused(Ts ... args);
+
+    template<typename ... Ts>
+    void
+    multi_visit_fused(Ts ... args) const;
+
     // It passes the values of each index and each named column to the
     // functor visitor sequentially from beginning to end
     //
@@ -3229,6 +3702,130 @@ public:  // Visitors
                            V &visitor,
                            bool in_reverse = false) const;
 
+    // Panel mode of single_act_visit() and load_result_as_column().
+    // It copies visitor for each of the named columns, runs the copies over
+    // their columns, and loads the result of each copy as the column with
+    // the same position in new_col_names. If thread level is set, the
+    // copies run in parallel. The new columns are loaded after all the
+    // copies are done.
+    // It returns the total number of items loaded.
+    //
+    // T:
+    //   Type of the named columns
+    // V:
+    //   Type of the visitor. It must be copyable and it must satisfy
+    //   load_result_as_column() requirements
+    // col_names:
+    //   Names of the data columns
+    // visitor:
+    //   The prototype visitor. It is not changed
+    // new_col_names:
+    //   Names of the result columns. It must be the same size as col_names
+    // padding:
+    //   If true, it pads the result columns with nan, if they are shorter
+    //   than the index column.
+    //
+    template<typename T, typename V>
+    size_type
+    single_act_visit_panel(const StlVecType<const char *> &col_names,
+                           const V &visitor,
+                           const StlVecType<const char *> &new_col_names,
+                           nan_policy padding = nan_policy::pad_with_nans);
+
+    // Grouped mode of single_act_visit() for long-format data, where rows of
+    // different keys (e.g. symbols) are interleaved.
+    // In one pass over the key column, it partitions the row positions by
+    // key, keeping the row order within each key. Then it copies visitor for
+    // each key and runs the copy over the index and column values of that
+    // key's rows. The result of each copy is scattered back to the rows it
+    // came from and loaded as new_col_name, aligned with the original rows.
+    // Rows with a missing key or no result are nan. If thread level is set,
+    // the keys are visited in parallel.
+    // It returns the number of keys.
+    //
+    // KT:
+    //   Type of the key column
+    // T:
+    //   Type of the named column
+    // V:
+    //   Type of the visitor. It must be copyable and it must satisfy
+    //   load_result_as_column() requirements
+    // key_name:
+    //   Name of the key column
+    // col_name:
+    //   Name of the data column
+    // visitor:
+    //   The prototype visitor. It is not changed
+    // new_col_name:
+    //   Name of the result column
+    //
+    template<typename KT, typename T, typename V>
+    size_type
+    single_act_visit_grouped(const char *key_name,
+                             const char *col_name,
+                             const V &visitor,
+                             const char *new_col_name);
+
+    // It subscribes a streaming visitor to the named column(s). The visitor
+    // must have the update() method of the streaming visitors, such as
+    // ExponentiallyWeightedMeanVisitor, RSIVisitor, MACDVisitor,
+    // ParabolicSARVisitor and VWAPVisitor.
+    // The visitor is brought up to date with the columns right away. After
+    // that, append_row(), append_index() and append_column() pass only the
+    // new rows to update(). So get_result() of the visitor is always current
+    // and each appended row costs O(1).
+    // Any other change to a subscribed column (e.g. load_column(), sort(),
+    // remove_data_by_*(), fill_missing() or touch_column()) is a full
+    // recompute: pre() and then update() over all the rows. Removing or
+    // renaming a subscribed column drops the subscription.
+    // A row is passed to the visitor once it is in the index and all the
+    // subscribed columns. post() is never called.
+    //
+    // NOTE: The visitor is referenced, not copied. It must be unsubscribed
+    //       before it is destroyed. Copies of the DataFrame do not have the
+    //       subscriptions.
+    //
+    // T:
+    //   Type of the named column
+    // V:
+    //   Type of the streaming visitor
+    // name:
+    //   Name of the data column
+    // visitor:
+    //   An instance of the visitor
+    //
+    template<typename T, typename V>
+    void
+    subscribe(const char *name, V &visitor);
+
+    // Same as above, but for visitors of two columns, e.g. VWAPVisitor
+    //
+    template<typename T1, typename T2, typename V>
+    void
+    subscribe(const char *name1, const char *name2, V &visitor);
+
+    // Same as above, but for visitors of three columns,
+    // e.g. ParabolicSARVisitor
+    //
+    template<typename T1, typename T2, typename T3, typename V>
+    void
+    subscribe(const char *name1,
+              const char *name2,
+              const char *name3,
+              V &visitor);
+
+    // It removes all the subscriptions of the visitor.
+    // It returns the number of subscriptions removed.
+    //
+    // V:
+    //   Type of the streaming visitor
+    // visitor:
+    //   The subscribed visitor
+    //
+    template<typename V>
+    size_type
+    unsubscribe(const V &visitor);
+
     // This is similar to visit(), but it passes a const reference to the index
     // vector and the two named column vectors at once the functor visitor.
     // This is convenient for calculations that need the whole data vector.
@@ -3612,6 +4209,33 @@ public:  // Utilities and miscellaneous
     void
     shrink_to_fit();
 
+    // It turns on or off a cache of series derived from columns, such as the
+    // moving means and standard deviations that many financial visitors
+    // compute over the same column. See DerivedCache.h.
+    // When it is on, the single_act_visit() family lets visitors fetch those
+    // series from the cache, instead of recomputing them. Each column has a
+    // version counter. DataFrame methods that change a column bump its
+    // version, which drops the column's cached series. Changing the index
+    // bumps all versions. Turning it off drops the cache.
+    //
+    // NOTE: If you change a column in place, through a reference from
+    //       get_column() or through a view, you must call touch_column().
+    //
+    void
+    enable_derived_cache(bool enable = true);
+
+    // It returns the derived cache, or nullptr if it is off
+    //
+    [[nodiscard]] const DerivedCache *
+    get_derived_cache() const;
+
+    // It bumps the version of the named column in the derived cache and
+    // drops its cached series. If name is nullptr, it does that for all
+    // columns. It is a no-op if the derived cache is off.
+    //
+    void
+    touch_column(const char *name);
+
     // This static method generates a date/time-based index vector that could
     // be fed directly to one of the load methods. Depending on the specified
     // frequency, it generates specific timestamps (see below).
@@ -3888,6 +4512,27 @@ private:
     //
     ColNameList     column_list_ { };  // Vector of column names and indices
 
+    // Opt-in cache of series derived from columns. See enable_derived_cache()
+    //
+    std::unique_ptr<DerivedCache>   derived_cache_ { };
+
+    // A streaming visitor that is fed the rows appended to its columns.
+    // See subscribe()
+    //
+    struct  Subscription  {
+
+        std::vector<std::string>    col_names { };
+        const void                  *visitor { nullptr };
+        size_type                   fed_cnt { 0 };  // Rows fed so far
+
+        // It feeds the visitor the rows from the given row on and returns
+        // the number of rows fed so far. Starting at row 0 resets the visitor
+        //
+        std::function<size_type(DataFrame &, size_type)>  feed { };
+    };
+
+    std::vector<Subscription>   subscriptions_ { };
+
     inline static SpinLock *lock_ { nullptr };  // No lock safety by default
 
     // Private methods
@@ -3912,6 +4557,7 @@ private:
 #  include <DataFrame/Internals/DataFrame_join.tcc>
 #  include <DataFrame/Internals/DataFrame_misc.tcc>
 #  include <DataFrame/Internals/DataFrame_opt.tcc>
+#  include <DataFrame/Internals/DataFrame_query.tcc>
 #  include <DataFrame/Internals/DataFrame_read.tcc>
 #  include <DataFrame/Internals/DataFrame_set.tcc>
 #  include <DataFrame/Internals/DataFrame_shift.tcc>
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <DataFrame/DataFrameStatsVisitors.h>
 #include <DataFrame/DataFrameTypes.h>
+#include <DataFrame/Utils/DerivedCache.h>
 
 #include <algorithm>
 #include <cmath>
@@ -38,6 +39,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <future>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
 #include <utility>
@@ -48,6 +50,39 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace hmdf
 {
 
+// It returns the span-decayed EWM of the column. It is fetched from the
+// derived cache of the visited DataFrame, if the cache is on.
+//
+template<typename T, typename I, std::size_t A, typename K, typename H>
+inline std::shared_ptr<const typename ewm_v<T, I, A>::result_type>
+_fetch_ewm_span_mean_(std::size_t span,
+                      bool finite_adjust,
+                      const K &idx_begin,
+                      const K &idx_end,
+                      const H &column_begin,
+                      const H &column_end)  {
+
+    using series_t = typename ewm_v<T, I, A>::result_type;
+
+    return (DerivedCache::fetch<series_t>(
+                column_begin,
+                std::distance(column_begin, column_end),
+                derived_series::ewm_span_mean,
+                double(span), double(finite_adjust),
+                [&]() -> series_t  {
+                    ewm_v<T, I, A>  ewm (exponential_decay_spec::span,
+                                         T(span),
+                                         finite_adjust);
+
+                    ewm.pre();
+                    ewm (idx_begin, idx_end, column_begin, column_end);
+                    ewm.post();
+                    return (std::move(ewm.get_result()));
+                }));
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T, typename I = unsigned long, std::size_t A = 0,
          typename =
              typename std::enable_if<supports_arithmetic<T>::value, T>::type>
@@ -263,33 +298,60 @@ struct BollingerBand {
 
 private:
 
-    const double                                    upper_band_multiplier_;
-    const double                                    lower_band_multiplier_;
-    SimpleRollAdopter<MeanVisitor<T, I>, T, I, A>   mean_roller_;
-    SimpleRollAdopter<StdVisitor<T, I>, T, I, A>    std_roller_;
+    using mean_roller_t = SimpleRollAdopter<MeanVisitor<T, I>, T, I, A>;
+    using std_roller_t = SimpleRollAdopter<StdVisitor<T, I>, T, I, A>;
+    using series_t = typename mean_roller_t::result_type;
+
+    const double        upper_band_multiplier_;
+    const double        lower_band_multiplier_;
+    const std::size_t   moving_mean_period_;
+    const bool          biased_;
+    mean_roller_t       mean_roller_;
+    std_roller_t        std_roller_;
 
+    // The moving mean and std are fetched from the DataFrame's derived
+    // cache, if it is on. Otherwise, they are just computed.
+    //
     template <typename K, typename H>
-    inline void
+    inline std::shared_ptr<const series_t>
     run_mean_roller_(const K &idx_begin,
                      const K &idx_end,
                      const H &prices_begin,
                      const H &prices_end)  {
 
-        mean_roller_.pre();
-        mean_roller_(idx_begin, idx_end, prices_begin, prices_end);
-        mean_roller_.post();
+        return (DerivedCache::fetch<series_t>(
+                    prices_begin,
+                    std::distance(prices_begin, prices_end),
+                    derived_series::rolling_mean,
+                    double(moving_mean_period_), 0,
+                    [&]() -> series_t  {
+                        mean_roller_.pre();
+                        mean_roller_(idx_begin, idx_end,
+                                     prices_begin, prices_end);
+                        mean_roller_.post();
+                        return (std::move(mean_roller_.get_result()));
+                    }));
     }
 
     template <typename K, typename H>
-    inline void
+    inline std::shared_ptr<const series_t>
     run_std_roller_(const K &idx_begin,
                     const K &idx_end,
                     const H &prices_begin,
                     const H &prices_end)  {
 
-        std_roller_.pre();
-        std_roller_(idx_begin, idx_end, prices_begin, prices_end);
-        std_roller_.post();
+        return (DerivedCache::fetch<series_t>(
+                    prices_begin,
+                    std::distance(prices_begin, prices_end),
+                    derived_series::rolling_std,
+                    double(moving_mean_period_), double(biased_),
+                    [&]() -> series_t  {
+                        std_roller_.pre();
+                        std_roller_(idx_begin, idx_end,
+                                    prices_begin, prices_end);
+                        std_roller_.post();
+                        return (std::move(std_roller_.get_result()));
+                    }));
     }
 
 public:
@@ -303,35 +365,34 @@ public:
 
         const size_type thread_level =
             ThreadGranularity::get_sensible_thread_level();
+        std::shared_ptr<const series_t> mean_ptr;
+        std::shared_ptr<const series_t> std_ptr;
 
         if (thread_level >= 2)  {
-            std::future<void>   fut1 =
-                std::async(std::launch::async,
-                           &BollingerBand::run_mean_roller_<K, H>,
-                           this,
-                           std::cref(idx_begin),
-                           std::cref(idx_end),
-                           std::cref(prices_begin),
-                           std::cref(prices_end));
-            std::future<void>   fut2 =
+            const DerivedCache::Scope   *scope = DerivedCache::Scope::current();
+            std::future<void>           fut =
                 std::async(std::launch::async,
-                           &BollingerBand::run_std_roller_<K, H>,
-                           this,
-                           std::cref(idx_begin),
-                           std::cref(idx_end),
-                           std::cref(prices_begin),
-                           std::cref(prices_end));
+                           [&, scope]() -> void  {
+                               const DerivedCache::Scope   s (scope);
+
+                               std_ptr = run_std_roller_(idx_begin, idx_end,
+                                                         prices_begin,
+                                                         prices_end);
+                           });
 
-            fut1.get();
-            fut2.get();
+            mean_ptr =
+                run_mean_roller_(idx_begin, idx_end, prices_begin, prices_end);
+            fut.get();
         }
         else  {
-            run_mean_roller_(idx_begin, idx_end, prices_begin, prices_end);
-            run_std_roller_(idx_begin, idx_end, prices_begin, prices_end);
+            mean_ptr =
+                run_mean_roller_(idx_begin, idx_end, prices_begin, prices_end);
+            std_ptr =
+                run_std_roller_(idx_begin, idx_end, prices_begin, prices_end);
         }
 
-        const auto      &std_result = std_roller_.get_result();
-        const auto      &mean_result = mean_roller_.get_result();
+        const auto      &std_result = *std_ptr;
+        const auto      &mean_result = *mean_ptr;
         const size_type col_s =
             std::min<size_type>(
                 { size_t(std::distance(idx_begin, idx_end)),
@@ -372,6 +433,8 @@ public:
                          bool biased = false)
         : upper_band_multiplier_(upper_band_multiplier),
           lower_band_multiplier_(lower_band_multiplier),
+          moving_mean_period_(moving_mean_period),
+          biased_(biased),
           mean_roller_(std::move(MeanVisitor<T, I>()), moving_mean_period),
           std_roller_(std::move(StdVisitor<T, I>(biased)), moving_mean_period) {
     }
@@ -391,6 +454,12 @@ template<typename T, typename I = unsigned long, std::size_t A = 0,
              typename std::enable_if<supports_arithmetic<T>::value, T>::type>
 struct MACDVisitor {
 
+private:
+
+    using macd_roller_t = ewm_v<T, I, A>;
+
+public:
+
     DEFINE_VISIT_BASIC_TYPES_3
 
     template <typename K, typename H>
@@ -398,22 +467,16 @@ struct MACDVisitor {
     operator() (const K &idx_begin, const K &idx_end,
                 const H &column_begin, const H &column_end)  {
 
-        macd_roller_t   short_roller (exponential_decay_spec::span,
-                                      short_mean_period_);
-
-        short_roller.pre();
-        short_roller(idx_begin, idx_end, column_begin, column_end);
-        short_roller.post();
-
-        macd_roller_t   long_roller (exponential_decay_spec::span,
-                                     long_mean_period_);
-
-        long_roller.pre();
-        long_roller(idx_begin, idx_end, column_begin, column_end);
-        long_roller.post();
-
-        const auto      &short_result = short_roller.get_result();
-        const auto      &long_result = long_roller.get_result();
+        const auto      short_ptr =
+            _fetch_ewm_span_mean_<T, I, A>(short_mean_period_, false,
+                                           idx_begin, idx_end,
+                                           column_begin, column_end);
+        const auto      long_ptr =
+            _fetch_ewm_span_mean_<T, I, A>(long_mean_period_, false,
+                                           idx_begin, idx_end,
+                                           column_begin, column_end);
+        const auto      &short_result = *short_ptr;
+        const auto      &long_result = *long_ptr;
         const size_type col_s =
             std::min<size_type>(
                 { size_t(std::distance(idx_begin, idx_end)),
@@ -435,12 +498,72 @@ struct MACDVisitor {
         macd_histogram_.reserve(col_s);
         for (size_type i { 0 }; i < col_s; ++i)
             macd_histogram_.push_back(macd_line_[i] - signal_line_result[i]);
+
+        // The short and long EMAs carry on from the end of the column
+        //
+        const bool  started =
+            std::find_if(column_begin, column_end,
+                         [](const value_type &val) -> bool  {
+                             return (! is_nan__(val));
+                         }) != column_end;
+
+        if (col_s > 0)  {
+            short_roller_.set_stream_state(
+                { short_result[col_s - 1], 1, 1, col_s, started });
+            long_roller_.set_stream_state(
+                { long_result[col_s - 1], 1, 1, col_s, started });
+        }
+    }
+
+    // The state needed to extend the results by one price at a time.
+    // It is trivially copyable, so it can be saved and restored as bytes.
+    //
+    struct  stream_state  {
+
+        typename macd_roller_t::stream_state    short_ema { };
+        typename macd_roller_t::stream_state    long_ema { };
+        typename macd_roller_t::stream_state    signal_line { };
+    };
+
+    // It extends the MACD line, signal line and histogram by the price that
+    // follows the prices seen so far, in O(1). It returns the new MACD line
+    // value. After a visit, the results are the same as if the whole column
+    // was visited again.
+    //
+    inline value_type update (const index_type &idx, const value_type &price)  {
+
+        // Only the state of the short and long EMAs is kept
+        //
+        const value_type    macd =
+            short_roller_.update(idx, price) - long_roller_.update(idx, price);
+
+        short_roller_.get_result().clear();
+        long_roller_.get_result().clear();
+        macd_line_.push_back(macd);
+        macd_histogram_.push_back(macd - signal_line_roller_.update(idx, macd));
+        return (macd);
+    }
+
+    inline stream_state get_stream_state () const  {
+
+        return (stream_state { short_roller_.get_stream_state(),
+                               long_roller_.get_stream_state(),
+                               signal_line_roller_.get_stream_state() });
+    }
+    inline void set_stream_state (const stream_state &state)  {
+
+        short_roller_.set_stream_state(state.short_ema);
+        long_roller_.set_stream_state(state.long_ema);
+        signal_line_roller_.set_stream_state(state.signal_line);
     }
 
     inline void pre ()  {
 
         macd_line_.clear();
         macd_histogram_.clear();
+        short_roller_.pre();
+        long_roller_.pre();
+        signal_line_roller_.pre();
     }
     inline void post ()  {  }
     const result_type &get_macd_line() const { return (macd_line_); }
@@ -458,16 +581,18 @@ struct MACDVisitor {
         size_type signal_line_period) // e.g.  9-day
         : short_mean_period_(short_mean_period),
           long_mean_period_(long_mean_period),
+          short_roller_(exponential_decay_spec::span, short_mean_period),
+          long_roller_(exponential_decay_spec::span, long_mean_period),
           signal_line_roller_(exponential_decay_spec::span,
                               signal_line_period)  {
     }
 
 private:
 
-    using macd_roller_t = ewm_v<T, I, A>;
-
     const size_type short_mean_period_;
     const size_type long_mean_period_;
+    macd_roller_t   short_roller_;
+    macd_roller_t   long_roller_;
     macd_roller_t   signal_line_roller_;
     result_type     macd_line_ { };       // short-mean EMA - long-mean EMA
     result_type     macd_histogram_ { };  // MACD Line - Signal Line
@@ -537,6 +662,14 @@ struct  VWAPVisitor {
     }
     PASS_DATA_ONE_BY_ONE_2
 
+    // VWAP is accumulated one trade at a time, so it extends the result by
+    // one trade in O(1). The last interval is added to the result by post().
+    //
+    inline void
+    update (const index_type &idx,
+            const value_type &price,
+            const value_type &size)  { (*this)(idx, price, size); }
+
     inline void pre ()  {
 
         result_.clear();
@@ -1047,9 +1180,15 @@ struct RSIVisitor {
 
         const size_type col_s = std::distance(prices_begin, prices_end);
 
-        // This data doesn't make sense
+        // This data doesn't make sense. The prices still warm up the stream.
         //
-        if (avg_period_ >= T(col_s - 3))  return;
+        if (avg_period_ + T(3) >= T(col_s))  {
+            result_.clear();
+            state_ = { };
+            for (auto citer = prices_begin; citer < prices_end; ++citer)
+                update(index_type { }, *citer);
+            return;
+        }
 
         ReturnVisitor<T, I, A>  return_v { rp_ };
 
@@ -1090,10 +1229,79 @@ struct RSIVisitor {
                 avg_down = (avg_down * avg_period_1 - value) / avg_period_;
             result.push_back(h - (h / (one + avg_up / avg_down)));
         }
+        state_.avg_up = avg_up;
+        state_.avg_down = avg_down;
+        state_.last_price = *(prices_begin + (col_s - 1));
+        state_.count = col_s;
         result_.swap(result);
     }
 
-    DEFINE_PRE_POST
+    // The state needed to extend the result by one price at a time.
+    // It is trivially copyable, so it can be saved and restored as bytes.
+    //
+    struct  stream_state  {
+
+        value_type  avg_up { 0 };
+        value_type  avg_down { 0 };
+        value_type  last_price { 0 };
+        size_type   count { 0 };  // Number of prices seen so far
+        value_type  held[4] { };  // RSIs not in the result yet
+    };
+
+    // It extends the result by the price that follows the prices seen so
+    // far, in O(1). It returns the new RSI, or NaN if there are not enough
+    // prices yet. After a visit, the result is the same as if the whole
+    // column was visited again.
+    // Like a visit, there is no result until more than avg_period + 3 prices
+    // are seen. The RSIs before that are held back and then added at once.
+    //
+    inline value_type update (const index_type &, const value_type &price)  {
+
+        static constexpr value_type one { 1 };
+        static constexpr value_type h { 100 };
+        value_type                  ret =
+            std::numeric_limits<value_type>::quiet_NaN();
+
+        if (state_.count > 0)  {
+            const value_type    value =
+                return_(price, state_.last_price);
+            const value_type    avg_period_1 { avg_period_ - one };
+
+            if (value > 0)
+                state_.avg_up =
+                    (state_.avg_up * avg_period_1 + value) / avg_period_;
+            else if (value < 0)
+                state_.avg_down =
+                    (state_.avg_down * avg_period_1 - value) / avg_period_;
+            if (T(state_.count) >= avg_period_ - one)  {
+                const value_type    rsi =
+                    h - (h / (one + state_.avg_up / state_.avg_down));
+                const size_type     held_i =
+                    state_.count + 1 - size_type(avg_period_);
+
+                if (held_i < 4)
+                    state_.held[held_i] = rsi;
+                else  {
+                    if (held_i == 4)
+                        result_.insert(result_.end(),
+                                       state_.held, state_.held + 4);
+                    result_.push_back(rsi);
+                    ret = rsi;
+                }
+            }
+        }
+        state_.last_price = price;
+        state_.count += 1;
+        return (ret);
+    }
+
+    inline const stream_state &
+    get_stream_state () const  { return (state_); }
+    inline void
+    set_stream_state (const stream_state &state)  { state_ = state; }
+
+    inline void pre ()  { result_.clear(); state_ = { }; }
+    inline void post ()  {  }
     DEFINE_RESULT
 
     explicit RSIVisitor(return_policy rp, size_type avg_period = 14)
@@ -1101,9 +1309,27 @@ struct RSIVisitor {
 
 private:
 
+    // Same as ReturnVisitor for one pair of prices
+    //
+    inline value_type
+    return_(value_type lhs, value_type rhs) const  {
+
+        if (rp_ == return_policy::percentage)
+            return ((lhs - rhs) / rhs);
+        else if (rp_ == return_policy::monetary)
+            return (lhs - rhs);
+        else if (rp_ == return_policy::trinary)  {
+            const value_type diff = lhs - rhs;
+
+            return ((diff > 0) ? 1 : ((diff < 0) ? -1 : 0));
+        }
+        return (std::log(lhs / rhs));
+    }
+
     const return_policy rp_;
     const value_type    avg_period_;
     result_type         result_ { };
+    stream_state        state_ { };
 };
 
 template<typename T, typename I = unsigned long, std::size_t A = 0>
@@ -2841,14 +3067,128 @@ struct  ParabolicSARVisitor  {
         long_.swap(long_vec);
         short_.swap(short_vec);
         accel_fact_.swap(accel_fact);
+
+        state_.bullish = bullish;
+        state_.high_point = high_point;
+        state_.low_point = low_point;
+        state_.current_af = current_af;
+        state_.sar = sar[col_s - 1];
+        state_.low_1 = *(low_begin + (col_s - 1));
+        state_.low_2 = *(low_begin + (col_s - 2));
+        state_.high_1 = *(high_begin + (col_s - 1));
+        state_.high_2 = *(high_begin + (col_s - 2));
+        state_.count = col_s;
+    }
+
+    // The state needed to extend the results by one bar at a time.
+    // It is trivially copyable, so it can be saved and restored as bytes.
+    //
+    struct  stream_state  {
+
+        bool        bullish { true };
+        value_type  high_point { 0 };
+        value_type  low_point { 0 };
+        value_type  current_af { 0 };
+        value_type  sar { 0 };
+        value_type  low_1 { 0 };   // Low of the previous bar
+        value_type  low_2 { 0 };   // Low of the bar before that
+        value_type  high_1 { 0 };
+        value_type  high_2 { 0 };
+        size_type   count { 0 };   // Number of bars seen so far
+    };
+
+    // It extends the results by the bar that follows the bars seen so far,
+    // in O(1). It returns true if the bar is a reversal. After a visit, the
+    // results are the same as if the whole columns were visited again.
+    //
+    inline bool update (const index_type &,
+                        const value_type &low,
+                        const value_type &high,
+                        const value_type &close)  {
+
+        constexpr value_type    nan = std::numeric_limits<T>::quiet_NaN();
+        bool                    reverse { false };
+        value_type              sar { close };
+
+        if (state_.count == 0)  {
+            state_.high_point = high;
+            state_.low_point = low;
+            state_.current_af = af_;
+        }
+
+        const value_type    current_af { state_.current_af };
+
+        if (state_.count >= 2)  {
+            if (state_.bullish)  {
+                sar = state_.sar +
+                      state_.current_af * (state_.high_point - state_.sar);
+                if (low < sar)  {
+                    state_.bullish = false;
+                    reverse = true;
+                    state_.current_af = af_;
+                    sar = state_.high_point;
+                    state_.low_point = low;
+                }
+            }
+            else  {
+                sar = state_.sar +
+                      state_.current_af * (state_.low_point - state_.sar);
+                if (high > sar)  {
+                    state_.bullish = true;
+                    reverse = true;
+                    state_.current_af = af_;
+                    sar = state_.low_point;
+                    state_.high_point = high;
+                }
+            }
+
+            if (! reverse)  {
+                if (state_.bullish)  {
+                    if (high > state_.high_point)  {
+                        state_.high_point = high;
+                        state_.current_af =
+                            std::min(state_.current_af + af_, max_af_);
+                    }
+                    if (state_.low_1 < sar)  sar = state_.low_1;
+                    if (state_.low_2 < sar)  sar = state_.low_2;
+                }
+                else  {
+                    if (low < state_.low_point)  {
+                        state_.low_point = low;
+                        state_.current_af =
+                            std::min(state_.current_af + af_, max_af_);
+                    }
+                    if (state_.high_1 > sar)  sar = state_.high_1;
+                    if (state_.high_2 > sar)  sar = state_.high_2;
+                }
+            }
+        }
+
+        result_.push_back(reverse);
+        accel_fact_.push_back(current_af);
+        long_.push_back(state_.count >= 2 && state_.bullish ? sar : nan);
+        short_.push_back(state_.count >= 2 && ! state_.bullish ? sar : nan);
+        state_.sar = sar;
+        state_.low_2 = state_.low_1;
+        state_.low_1 = low;
+        state_.high_2 = state_.high_1;
+        state_.high_1 = high;
+        state_.count += 1;
+        return (reverse);
     }
 
+    inline const stream_state &
+    get_stream_state () const  { return (state_); }
+    inline void
+    set_stream_state (const stream_state &state)  { state_ = state; }
+
     inline void pre ()  {
 
         result_.clear();
         long_.clear();
         short_.clear();
         accel_fact_.clear();
+        state_ = { };
     }
     inline void post ()  {  }
     DEFINE_RESULT
@@ -2891,6 +3231,7 @@ private:
     const value_type        af_;
     const value_type        max_af_;
     result_type             result_ { };
+    stream_state            state_ { };
 
     std::vector<value_type,
                 typename allocator_declare<value_type, A>::type> long_ { };
@@ -4587,12 +4928,10 @@ struct  KeltnerChannelsVisitor  {
            close_begin, close_end);
         tr.post();
 
-        ewm_v<T, I, A>  basis(exponential_decay_spec::span, roll_period_, true);
-
-        basis.pre();
-        basis (idx_begin, idx_end, close_begin, close_end);
-        basis.post();
-
+        const auto      basis =
+            _fetch_ewm_span_mean_<T, I, A>(roll_period_, true,
+                                           idx_begin, idx_end,
+                                           close_begin, close_end);
         ewm_v<T, I, A>  band(exponential_decay_spec::span, roll_period_, true);
 
         band.pre();
@@ -4603,10 +4942,9 @@ struct  KeltnerChannelsVisitor  {
         result_type lower_band { std::move(tr.get_result()) };
 
         for (size_type i { 0 }; i < col_s; ++i)
-            lower_band[i] =
-                basis.get_result()[i] - b_mult_ * band.get_result()[i];
+            lower_band[i] = (*basis)[i] - b_mult_ * band.get_result()[i];
 
-        result_type upper_band { std::move(basis.get_result()) };
+        result_type upper_band { basis->begin(), basis->end() };
 
         for (size_type i { 0 }; i < col_s; ++i)
             upper_band[i] += b_mult_ * band.get_result()[i];
@@ -4662,19 +5000,18 @@ struct TrixVisitor  {
 
         assert(col_s > 3);
 
-        ewm_v<T, I, A>  ewm13(exponential_decay_spec::span, roll_period_, true);
-
-        ewm13.pre();
-        ewm13 (idx_begin, idx_end, column_begin, column_end);
-        ewm13.post();
-
+        const auto      ewm1 =
+            _fetch_ewm_span_mean_<T, I, A>(roll_period_, true,
+                                           idx_begin, idx_end,
+                                           column_begin, column_end);
         ewm_v<T, I, A>  ewm2(exponential_decay_spec::span, roll_period_, true);
 
         ewm2.pre();
-        ewm2 (idx_begin, idx_end,
-              ewm13.get_result().begin(), ewm13.get_result().end());
+        ewm2 (idx_begin, idx_end, ewm1->begin(), ewm1->end());
         ewm2.post();
 
+        ewm_v<T, I, A>  ewm13(exponential_decay_spec::span, roll_period_, true);
+
         ewm13.pre();
         ewm13 (idx_begin, idx_end,
                ewm2.get_result().begin(), ewm2.get_result().end());
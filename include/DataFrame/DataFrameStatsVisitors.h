@@ -1370,22 +1370,15 @@ struct CumSumVisitor {
     operator() (const K &idx_begin, const K &idx_end,
                 const H &column_begin, const H &column_end)  {
 
-        value_type      running_sum = 0;
         GET_COL_SIZE
 
         result_type result;
 
-        result.reserve(col_s);
-        for (size_type i = 0; i < col_s; ++i)  {
-            const value_type    &value = *(column_begin + i);
-
-            if (! skip_nan_ || ! is_nan__(value))  {
-                running_sum += value;
-                result.push_back(running_sum);
-            }
-            else
-                result.push_back(value);
-        }
+        _cum_scan_(column_begin, col_s, value_type(0), true, skip_nan_,
+                   [](const value_type &lhs, const value_type &rhs)
+                       -> value_type  { return (lhs + rhs); },
+                   result,
+                   ThreadGranularity::get_sensible_thread_level());
         result_.swap(result);
     }
 
@@ -1412,22 +1405,15 @@ struct CumProdVisitor {
     operator() (const K &idx_begin, const K &idx_end,
                 const H &column_begin, const H &column_end)  {
 
-        value_type      running_prod = 1;
         GET_COL_SIZE
 
         result_type result;
 
-        result.reserve(col_s);
-        for (size_type i = 0; i < col_s; ++i)  {
-            const value_type    &value = *(column_begin + i);
-
-            if (! skip_nan_ || ! is_nan__(value))  {
-                running_prod *= value;
-                result.push_back(running_prod);
-            }
-            else
-                result.push_back(value);
-        }
+        _cum_scan_(column_begin, col_s, value_type(1), true, skip_nan_,
+                   [](const value_type &lhs, const value_type &rhs)
+                       -> value_type  { return (lhs * rhs); },
+                   result,
+                   ThreadGranularity::get_sensible_thread_level());
         result_.swap(result);
     }
 
@@ -1461,21 +1447,13 @@ struct CumExtremumVisitor {
 
         if (col_s == 0)  return;
 
-        value_type  running_extremum = *column_begin;
         result_type result;
 
-        result.reserve(col_s);
-        for (size_type i = 0; i < col_s; ++i)  {
-            const value_type    &value = *(column_begin + i);
-
-            if (! skip_nan_ || ! is_nan__(value))  {
-                if (cmp_(running_extremum, value))
-                    running_extremum = value;
-                result.push_back(running_extremum);
-            }
-            else
-                result.push_back(value);
-        }
+        _cum_scan_(column_begin, col_s, value_type(), false, skip_nan_,
+                   [this](const value_type &lhs, const value_type &rhs)
+                       -> value_type  { return (cmp_(lhs, rhs) ? rhs : lhs); },
+                   result,
+                   ThreadGranularity::get_sensible_thread_level());
         result_.swap(result);
     }
 
@@ -1894,35 +1872,172 @@ struct  ExponentiallyWeightedMeanVisitor  {
             }
         }
 
-        if (! finite_adjust_)  {
-            for (size_type i = starting + 1; i < col_s; ++i)  {
-                const value_type    val = *(column_begin + i);
+        // Both modes are linear recurrences. They are evaluated in blocks,
+        // each block's contribution is carried into the next one, and the
+        // blocks are written in parallel.
+        //
+        const size_type thread_level =
+            ThreadGranularity::get_sensible_thread_level();
 
-                if (! is_nan__(val))
-                    result[i] = decay_ * val + decay_comp * result[i - 1];
-            }
+        if (! finite_adjust_)  {
+            // A missing value resets the running mean
+            //
+            struct  mean_state  {
+                value_type  mean { 0 };
+                bool        reset { false };
+            };
+
+            const auto  step =
+                [this, &column_begin, decay_comp, starting]
+                (size_type i, mean_state &state) -> void  {
+                    const value_type    val = *(column_begin + i);
+
+                    if (i <= starting || is_nan__(val))  {
+                        state.mean = i == starting ? val : value_type(0);
+                        state.reset = true;
+                    }
+                    else
+                        state.mean = decay_ * val + decay_comp * state.mean;
+                };
+
+            _ewm_scan_(
+                col_s, mean_state { },
+                [&step](size_type b, size_type e) -> mean_state  {
+                    mean_state  state;
+
+                    for (size_type i = b; i < e; ++i)  step(i, state);
+                    return (state);
+                },
+                [decay_comp](const mean_state &state, const mean_state &added,
+                             size_type b, size_type e) -> mean_state  {
+                    if (added.reset)  return (added);
+                    return (mean_state {
+                        std::pow(decay_comp, value_type(e - b)) * state.mean +
+                            added.mean,
+                        false });
+                },
+                [&step, &result](size_type b, size_type e,
+                                 const mean_state &init) -> void  {
+                    mean_state  state = init;
+
+                    for (size_type i = b; i < e; ++i)  {
+                        step(i, state);
+                        result[i] = state.mean;
+                    }
+                },
+                thread_level);
+            state_.numerator = col_s > 0 ? result[col_s - 1] : 0;
         }
         else  {  // Adjust for the fact that this is not an infinite data set
-            value_type  denominator = 1;
-            value_type  decay_comp_prod = 1;
-            value_type  numerator = result[0];
-
-            for (size_type i = starting + 1; i < col_s; ++i)  {
-                const value_type    val = *(column_begin + i);
-
-                if (! is_nan__(val))  {
-                    decay_comp_prod *= decay_comp;
-                    denominator += decay_comp_prod;
-                    numerator = numerator * decay_comp + val;
-                    result[i] = numerator / denominator;
-                }
-            }
+            struct  adjust_state  {
+                value_type  numerator { 0 };
+                value_type  denominator { 0 };
+                value_type  decay_comp_prod { 1 };
+            };
+
+            const auto  step =
+                [&column_begin, decay_comp, starting]
+                (size_type i, adjust_state &state) -> bool  {
+                    const value_type    val = *(column_begin + i);
+
+                    if (i <= starting || is_nan__(val))  return (false);
+                    state.decay_comp_prod *= decay_comp;
+                    state.denominator += state.decay_comp_prod;
+                    state.numerator = state.numerator * decay_comp + val;
+                    return (true);
+                };
+
+            _ewm_scan_(
+                col_s, adjust_state { result[0], 1, 1 },
+                [&step](size_type b, size_type e) -> adjust_state  {
+                    adjust_state    state;
+
+                    for (size_type i = b; i < e; ++i)  step(i, state);
+                    return (state);
+                },
+                [](const adjust_state &state, const adjust_state &added,
+                   size_type, size_type) -> adjust_state  {
+                    return (adjust_state {
+                        state.numerator * added.decay_comp_prod +
+                            added.numerator,
+                        state.denominator +
+                            state.decay_comp_prod * added.denominator,
+                        state.decay_comp_prod * added.decay_comp_prod });
+                },
+                [this, &step, &result, col_s]
+                (size_type b, size_type e, const adjust_state &init) -> void  {
+                    adjust_state    state = init;
+
+                    for (size_type i = b; i < e; ++i)
+                        if (step(i, state))
+                            result[i] = state.numerator / state.denominator;
+                    if (e == col_s)  {
+                        state_.numerator = state.numerator;
+                        state_.denominator = state.denominator;
+                        state_.decay_comp_prod = state.decay_comp_prod;
+                    }
+                },
+                thread_level);
         }
 
+        state_.count = col_s;
+        state_.started = starting < col_s;
         result_.swap(result);
     }
 
-    DEFINE_PRE_POST
+    // The state needed to extend the result by one value at a time.
+    // It is trivially copyable, so it can be saved and restored as bytes.
+    //
+    struct  stream_state  {
+
+        value_type  numerator { 0 };  // The mean, if not finite_adjust
+        value_type  denominator { 1 };
+        value_type  decay_comp_prod { 1 };
+        size_type   count { 0 };      // Number of values seen so far
+        bool        started { false };  // Whether a valid value was seen
+    };
+
+    // It extends the result by the value that follows the values seen so
+    // far, in O(1), and returns the new result. The result is the same as
+    // if the whole column was visited again.
+    //
+    inline value_type update (const index_type &, const value_type &val)  {
+
+        const value_type    decay_comp = T(1) - decay_;
+        value_type          ret { 0 };
+
+        if (! state_.started)  {
+            if (! is_nan__(val))  {
+                state_.started = true;
+                ret = val;
+                state_.numerator =
+                    finite_adjust_ && state_.count > 0 ? value_type(0) : val;
+            }
+        }
+        else if (! finite_adjust_)  {
+            state_.numerator = is_nan__(val)
+                ? value_type(0)
+                : decay_ * val + decay_comp * state_.numerator;
+            ret = state_.numerator;
+        }
+        else if (! is_nan__(val))  {
+            state_.decay_comp_prod *= decay_comp;
+            state_.denominator += state_.decay_comp_prod;
+            state_.numerator = state_.numerator * decay_comp + val;
+            ret = state_.numerator / state_.denominator;
+        }
+        state_.count += 1;
+        result_.push_back(ret);
+        return (ret);
+    }
+
+    inline const stream_state &
+    get_stream_state () const  { return (state_); }
+    inline void
+    set_stream_state (const stream_state &state)  { state_ = state; }
+
+    inline void pre ()  { result_.clear(); state_ = { }; }
+    inline void post ()  {  }
     DEFINE_RESULT
 
     ExponentiallyWeightedMeanVisitor(exponential_decay_spec eds,
@@ -1942,6 +2057,7 @@ private:
     const value_type    decay_;
     const bool          finite_adjust_;
     result_type         result_ {  };
+    stream_state        state_ {  };
 };
 
 template<typename T, typename I = unsigned long, std::size_t A = 0>
@@ -1964,58 +2080,52 @@ struct  ExponentiallyWeightedVarVisitor  {
         GET_COL_SIZE
         assert(col_s > 3);
 
-        result_type         ewmvar;
-        result_type         ewmstd;
+        result_type         ewmvar (col_s,
+                                    std::numeric_limits<T>::quiet_NaN());
+        result_type         ewmstd (col_s,
+                                    std::numeric_limits<T>::quiet_NaN());
         const value_type    decay_comp = T(1) - decay_;
         size_type           starting = 0;
 
-        ewmvar.reserve(col_s);
-        ewmstd.reserve(col_s);
-        for (; starting < col_s; ++starting)  {
-            if (is_nan__(*(column_begin + starting)))  {
-                ewmvar.push_back(std::numeric_limits<T>::quiet_NaN());
-                ewmstd.push_back(std::numeric_limits<T>::quiet_NaN());
-            }
-            else  break;
-        }
-
-        ewmvar.push_back(std::numeric_limits<T>::quiet_NaN());
-        ewmstd.push_back(std::numeric_limits<T>::quiet_NaN());
-        for (size_type i = starting + 1; i < col_s; ++i)  {
-            value_type  sum_weights = 0;
-            value_type  sum_sq_weights = 0;
-            value_type  sum_weighted_input = 0;
-
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    input = *(column_begin + (i - j));
-
-                sum_weights += weight;
-                sum_weighted_input += weight * input;
-                sum_sq_weights += weight * weight;
-            }
-
-            // Calculate exponential moving average
-            const value_type    ewma = sum_weighted_input / sum_weights;
-            value_type          factor_sum = 0;
+        while (starting < col_s && is_nan__(*(column_begin + starting)))
+            starting += 1;
 
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    input = *(column_begin + (i - j));
-
-                factor_sum += weight * (input - ewma) * (input - ewma);
-            }
-
-            // Calculate exponential moving variance and standard deviation
-            // with bias
-            const value_type    sum_weights_sq = sum_weights * sum_weights;
-            const value_type    bias =
-                    sum_weights_sq / (sum_weights_sq - sum_sq_weights);
-            const value_type    var = bias * factor_sum / sum_weights;
-
-            ewmvar.push_back(var);
-            ewmstd.push_back(std::sqrt(var));
-        }
+        // The weighted sums are linear recurrences, so each position costs
+        // O(1) and the column is evaluated in parallel blocks. The inputs
+        // are shifted by the first value to keep the sums from cancelling.
+        //
+        const value_type    shift =
+            starting < col_s ? *(column_begin + starting) : T(0);
+
+        _ewm_sums_scan_<value_type, 4>(
+            col_s, decay_comp,
+            [&column_begin, shift](size_type i,
+                                   std::array<value_type, 4> &terms) -> void  {
+                const value_type    input = *(column_begin + i) - shift;
+
+                terms[2] = input;
+                terms[3] = input * input;
+            },
+            [&ewmvar, &ewmstd, starting]
+            (size_type i, const std::array<value_type, 4> &sums) -> void  {
+                if (i <= starting)  return;
+
+                // Calculate exponential moving average
+                const value_type    ewma = sums[2] / sums[0];
+                const value_type    factor_sum =
+                    std::max(sums[3] - sums[2] * ewma, value_type(0));
+
+                // Calculate exponential moving variance and standard
+                // deviation with bias
+                const value_type    sum_weights_sq = sums[0] * sums[0];
+                const value_type    bias =
+                    sum_weights_sq / (sum_weights_sq - sums[1]);
+                const value_type    var = bias * factor_sum / sums[0];
+
+                ewmvar[i] = var;
+                ewmstd[i] = std::sqrt(var);
+            },
+            ThreadGranularity::get_sensible_thread_level());
 
         ewmvar_.swap(ewmvar);
         ewmstd_.swap(ewmstd);
@@ -2069,56 +2179,48 @@ struct  ExponentiallyWeightedCovVisitor  {
         assert((col_s == size_type(std::distance(y_begin, y_end))));
         assert(col_s > 3);
 
-        result_type         ewmcov;
+        result_type         ewmcov (col_s,
+                                    std::numeric_limits<T>::quiet_NaN());
         const value_type    decay_comp = T(1) - decay_;
         size_type           starting = 0;
 
-        ewmcov.reserve(col_s);
-        for (; starting < col_s; ++starting)
-            if (is_nan__(*(x_begin + starting)) ||
-                is_nan__(*(y_begin + starting)))
-                ewmcov.push_back(std::numeric_limits<T>::quiet_NaN());
-            else  break;
-
-        ewmcov.push_back(std::numeric_limits<T>::quiet_NaN());
-        for (size_type i = starting + 1; i < col_s; ++i)  {
-            value_type  sum_weights = 0;
-            value_type  sum_sq_weights = 0;
-            value_type  sum_weighted_inputx = 0;
-            value_type  sum_weighted_inputy = 0;
-
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    inputx = *(x_begin + (i - j));
-                const value_type    inputy = *(y_begin + (i - j));
-
-                sum_weights += weight;
-                sum_weighted_inputx += weight * inputx;
-                sum_weighted_inputy += weight * inputy;
-                sum_sq_weights += weight * weight;
-            }
-
-            // Calculate exponential moving average
-            const value_type    ewmax = sum_weighted_inputx / sum_weights;
-            const value_type    ewmay = sum_weighted_inputy / sum_weights;
-            value_type          factor_sum = 0;
+        while (starting < col_s &&
+               (is_nan__(*(x_begin + starting)) ||
+                is_nan__(*(y_begin + starting))))
+            starting += 1;
 
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    inputx = *(x_begin + (i - j));
-                const value_type    inputy = *(y_begin + (i - j));
-
-                factor_sum += weight * (inputx - ewmax) * (inputy - ewmay);
-            }
-
-            // Calculate exponential moving covariance with bias
-            const value_type    sum_weights_sq = sum_weights * sum_weights;
-            const value_type    bias =
-                    sum_weights_sq / (sum_weights_sq - sum_sq_weights);
-            const value_type    cov = bias * factor_sum / sum_weights;
-
-            ewmcov.push_back(cov);
-        }
+        // See ExponentiallyWeightedVarVisitor
+        //
+        const value_type    shiftx =
+            starting < col_s ? *(x_begin + starting) : T(0);
+        const value_type    shifty =
+            starting < col_s ? *(y_begin + starting) : T(0);
+
+        _ewm_sums_scan_<value_type, 5>(
+            col_s, decay_comp,
+            [&x_begin, &y_begin, shiftx, shifty]
+            (size_type i, std::array<value_type, 5> &terms) -> void  {
+                const value_type    inputx = *(x_begin + i) - shiftx;
+                const value_type    inputy = *(y_begin + i) - shifty;
+
+                terms[2] = inputx;
+                terms[3] = inputy;
+                terms[4] = inputx * inputy;
+            },
+            [&ewmcov, starting]
+            (size_type i, const std::array<value_type, 5> &sums) -> void  {
+                if (i <= starting)  return;
+
+                // Calculate exponential moving covariance with bias
+                const value_type    factor_sum =
+                    sums[4] - sums[2] * sums[3] / sums[0];
+                const value_type    sum_weights_sq = sums[0] * sums[0];
+                const value_type    bias =
+                    sum_weights_sq / (sum_weights_sq - sums[1]);
+
+                ewmcov[i] = bias * factor_sum / sums[0];
+            },
+            ThreadGranularity::get_sensible_thread_level());
 
         ewmcov_.swap(ewmcov);
     }
@@ -2168,62 +2270,60 @@ struct  ExponentiallyWeightedCorrVisitor  {
         assert((col_s == size_type(std::distance(y_begin, y_end))));
         assert(col_s > 3);
 
-        result_type         ewmcorr;
+        result_type         ewmcorr (col_s,
+                                     std::numeric_limits<T>::quiet_NaN());
         const value_type    decay_comp = T(1) - decay_;
         size_type           starting = 0;
 
-        ewmcorr.reserve(col_s);
-        for (; starting < col_s; ++starting)
-            if (is_nan__(*(x_begin + starting)) ||
-                is_nan__(*(y_begin + starting)))
-                ewmcorr.push_back(std::numeric_limits<T>::quiet_NaN());
-            else  break;
-
-        ewmcorr.push_back(std::numeric_limits<T>::quiet_NaN());
-        for (size_type i = starting + 1; i < col_s; ++i)  {
-            value_type  sum_weights = 0;
-            value_type  sum_sq_weights = 0;
-            value_type  sum_weighted_inputx = 0;
-            value_type  sum_weighted_inputy = 0;
-
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    inputx = *(x_begin + (i - j));
-                const value_type    inputy = *(y_begin + (i - j));
-
-                sum_weights += weight;
-                sum_weighted_inputx += weight * inputx;
-                sum_weighted_inputy += weight * inputy;
-                sum_sq_weights += weight * weight;
-            }
-
-            // Calculate exponential moving average
-            const value_type    ewmax = sum_weighted_inputx / sum_weights;
-            const value_type    ewmay = sum_weighted_inputy / sum_weights;
-            value_type          factor_sum = 0;
-            value_type          factor_sumx = 0;
-            value_type          factor_sumy = 0;
-
-            for (long j = long(i); j >= 0; --j)  {
-                const value_type    weight = ::pow(decay_comp, j);
-                const value_type    inputx = *(x_begin + (i - j));
-                const value_type    inputy = *(y_begin + (i - j));
-
-                factor_sum += weight * (inputx - ewmax) * (inputy - ewmay);
-                factor_sumx += weight * (inputx - ewmax) * (inputx - ewmax);
-                factor_sumy += weight * (inputy - ewmay) * (inputy - ewmay);
-            }
-
-            // Calculate exponential moving correlation with bias
-            const value_type    sum_weights_sq = sum_weights * sum_weights;
-            const value_type    bias =
-                    sum_weights_sq / (sum_weights_sq - sum_sq_weights);
-            const value_type    cov = bias * factor_sum / sum_weights;
-            const value_type    varx = bias * factor_sumx / sum_weights;
-            const value_type    vary = bias * factor_sumy / sum_weights;
+        while (starting < col_s &&
+               (is_nan__(*(x_begin + starting)) ||
+                is_nan__(*(y_begin + starting))))
+            starting += 1;
 
-            ewmcorr.push_back(cov / std::sqrt(varx * vary));
-        }
+        // See ExponentiallyWeightedVarVisitor
+        //
+        const value_type    shiftx =
+            starting < col_s ? *(x_begin + starting) : T(0);
+        const value_type    shifty =
+            starting < col_s ? *(y_begin + starting) : T(0);
+
+        _ewm_sums_scan_<value_type, 7>(
+            col_s, decay_comp,
+            [&x_begin, &y_begin, shiftx, shifty]
+            (size_type i, std::array<value_type, 7> &terms) -> void  {
+                const value_type    inputx = *(x_begin + i) - shiftx;
+                const value_type    inputy = *(y_begin + i) - shifty;
+
+                terms[2] = inputx;
+                terms[3] = inputy;
+                terms[4] = inputx * inputy;
+                terms[5] = inputx * inputx;
+                terms[6] = inputy * inputy;
+            },
+            [&ewmcorr, starting]
+            (size_type i, const std::array<value_type, 7> &sums) -> void  {
+                if (i <= starting)  return;
+
+                const value_type    factor_sum =
+                    sums[4] - sums[2] * sums[3] / sums[0];
+                const value_type    factor_sumx =
+                    std::max(sums[5] - sums[2] * sums[2] / sums[0],
+                             value_type(0));
+                const value_type    factor_sumy =
+                    std::max(sums[6] - sums[3] * sums[3] / sums[0],
+                             value_type(0));
+
+                // Calculate exponential moving correlation with bias
+                const value_type    sum_weights_sq = sums[0] * sums[0];
+                const value_type    bias =
+                    sum_weights_sq / (sum_weights_sq - sums[1]);
+                const value_type    cov = bias * factor_sum / sums[0];
+                const value_type    varx = bias * factor_sumx / sums[0];
+                const value_type    vary = bias * factor_sumy / sums[0];
+
+                ewmcorr[i] = cov / std::sqrt(varx * vary);
+            },
+            ThreadGranularity::get_sensible_thread_level());
 
         ewmcorr_.swap(ewmcorr);
     }
@@ -36,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // ----------------------------------------------------------------------------
@@ -127,6 +129,34 @@ enum class  join_policy : unsigned char  {
 
 // ----------------------------------------------------------------------------
 
+// This is how the join keys are matched. It doesn't change which rows are
+// joined, only the order of the result rows
+//
+enum class  join_algorithm : unsigned char  {
+    // Sort both sides by key and merge them. The result is in key order
+    //
+    sort_merge = 1,
+
+    // Hash the smaller side and probe it with the larger side. Large inputs
+    // are radix partitioned and joined in parallel if thread level is set.
+    // The result is in lhs row order followed by unmatched rhs rows, or in
+    // rhs row order for right joins. Keys must be hashable by std::hash
+    //
+    hash = 2,
+};
+
+// ----------------------------------------------------------------------------
+
+// This is how join_asof() picks the rhs row for each lhs row
+//
+enum class  asof_policy : unsigned char  {
+    backward = 1,  // The last rhs row with index <= lhs index
+    forward = 2,   // The first rhs row with index >= lhs index
+    nearest = 3,   // The closer of the above two. Ties go backward
+};
+
+// ----------------------------------------------------------------------------
+
 enum class  concat_policy : unsigned char  {
     common_columns = 1,
     all_columns = 2,
@@ -554,6 +584,20 @@ struct  supports_arithmetic<
            decltype(std::declval<T>() / std::declval<T>())>>
     : std::true_type  {  };
 
+// True if the difference of two T's converts to double, such as arithmetic
+// types and DateTime. join_asof() uses it to measure the distance between
+// two indices
+//
+template<typename T, typename = void>
+struct  supports_distance : std::false_type  {  };
+
+template<typename T>
+struct  supports_distance<
+    T,
+    void_t<decltype(static_cast<double>(std::declval<const T &>() -
+                                        std::declval<const T &>()))>>
+    : std::true_type  {  };
+
 // ----------------------------------------------------------------------------
 
 // I stands for Index type
@@ -620,6 +664,185 @@ struct  MemUsage  {
 
 // ----------------------------------------------------------------------------
 
+// A sel_functor passed to get_data_by_sel() or remove_data_by_sel() is
+// called serially, in row order. Wrap it in concurrent_sel() to let those
+// calls run it on many threads at once when a thread level is set. Only do
+// that if the functor is safe to call concurrently and doesn't depend on
+// the order of the rows.
+//
+template<typename F>
+struct  ConcurrentSel  {
+
+    F   functor;
+
+    template<typename ... As>
+    bool operator() (As && ... args)  {
+
+        return (functor(std::forward<As>(args) ...));
+    }
+    template<typename ... As>
+    bool operator() (As && ... args) const  {
+
+        return (functor(std::forward<As>(args) ...));
+    }
+};
+
+template<typename F>
+inline ConcurrentSel<F>
+concurrent_sel(F functor)  { return { std::move(functor) }; }
+
+template<typename F>
+struct  is_concurrent_sel : std::false_type  {  };
+
+template<typename F>
+struct  is_concurrent_sel<ConcurrentSel<F>> : std::true_type  {  };
+
+// ----------------------------------------------------------------------------
+
+// Selection predicates for get_data_by_pred() and friends.
+// Unlike a sel_functor, they are not opaque. Each comparison is evaluated
+// over a whole column into a bitmap in a tight loop that the compiler can
+// vectorize. The bitmaps are then combined with &&, ||, and !.
+// e.g.:
+//     sel_col<double>("price") > 10.5 && sel_col<long>("volume") >= 1000
+//
+// A column name of "INDEX" (DF_INDEX_COL_NAME) refers to the index.
+// Rows beyond the end of a column never match.
+//
+enum class  compare_op : unsigned char  {
+    eq = 1,  // ==
+    ne = 2,  // !=
+    lt = 3,  // <
+    le = 4,  // <=
+    gt = 5,  // >
+    ge = 6,  // >=
+};
+
+template<typename T>
+struct  SelCompare  {
+
+    using type = T;
+
+    const char  *col_name;
+    compare_op  op;
+    T           value;
+};
+
+// low <= value < high
+//
+template<typename T>
+struct  SelRange  {
+
+    using type = T;
+
+    const char  *col_name;
+    T           low;
+    T           high;
+};
+
+template<typename T>
+struct  SelIn  {
+
+    using type = T;
+
+    const char      *col_name;
+    std::vector<T>  values;
+};
+
+// The fallback for logic that is not a comparison. functor is called with
+// each column value and returns bool.
+//
+template<typename T, typename F>
+struct  SelFunctor  {
+
+    using type = T;
+
+    const char  *col_name;
+    F           functor;
+};
+
+template<typename L, typename R>
+struct  SelAnd  { L lhs; R rhs; };
+
+template<typename L, typename R>
+struct  SelOr  { L lhs; R rhs; };
+
+template<typename P>
+struct  SelNot  { P pred; };
+
+template<typename T>
+struct  SelColumn  {
+
+    const char  *col_name;
+
+    SelCompare<T>
+    operator == (const T &v) const  { return { col_name, compare_op::eq, v }; }
+    SelCompare<T>
+    operator != (const T &v) const  { return { col_name, compare_op::ne, v }; }
+    SelCompare<T>
+    operator < (const T &v) const  { return { col_name, compare_op::lt, v }; }
+    SelCompare<T>
+    operator <= (const T &v) const  { return { col_name, compare_op::le, v }; }
+    SelCompare<T>
+    operator > (const T &v) const  { return { col_name, compare_op::gt, v }; }
+    SelCompare<T>
+    operator >= (const T &v) const  { return { col_name, compare_op::ge, v }; }
+
+    SelRange<T>
+    between(const T &low, const T &high) const  {
+
+        return { col_name, low, high };
+    }
+    SelIn<T>
+    in(std::vector<T> values) const  {
+
+        return { col_name, std::move(values) };
+    }
+
+    template<typename F>
+    SelFunctor<T, F>
+    where(F functor) const  { return { col_name, std::move(functor) }; }
+};
+
+template<typename T>
+inline SelColumn<T>
+sel_col(const char *col_name)  { return { col_name }; }
+
+template<typename P>
+struct  is_sel_pred : std::false_type  {  };
+template<typename T>
+struct  is_sel_pred<SelCompare<T>> : std::true_type  {  };
+template<typename T>
+struct  is_sel_pred<SelRange<T>> : std::true_type  {  };
+template<typename T>
+struct  is_sel_pred<SelIn<T>> : std::true_type  {  };
+template<typename T, typename F>
+struct  is_sel_pred<SelFunctor<T, F>> : std::true_type  {  };
+template<typename L, typename R>
+struct  is_sel_pred<SelAnd<L, R>> : std::true_type  {  };
+template<typename L, typename R>
+struct  is_sel_pred<SelOr<L, R>> : std::true_type  {  };
+template<typename P>
+struct  is_sel_pred<SelNot<P>> : std::true_type  {  };
+
+template<typename L, typename R,
+         typename = std::enable_if_t<is_sel_pred<L>::value &&
+                                     is_sel_pred<R>::value>>
+inline SelAnd<L, R>
+operator && (L lhs, R rhs)  { return { std::move(lhs), std::move(rhs) }; }
+
+template<typename L, typename R,
+         typename = std::enable_if_t<is_sel_pred<L>::value &&
+                                     is_sel_pred<R>::value>>
+inline SelOr<L, R>
+operator || (L lhs, R rhs)  { return { std::move(lhs), std::move(rhs) }; }
+
+template<typename P, typename = std::enable_if_t<is_sel_pred<P>::value>>
+inline SelNot<P>
+operator ! (P pred)  { return { std::move(pred) }; }
+
+// ----------------------------------------------------------------------------
+
 // Helper macro for building DataFrame
 // e.g.:
 // struct MyDfSchema  {
@@ -59,9 +59,15 @@ DataFrame<I, H>::operator= (const DataFrame &that)  {
         column_tb_ = that.column_tb_;
         column_list_ = that.column_list_;
 
+        if (that.derived_cache_)
+            derived_cache_ = std::make_unique<DerivedCache>();
+        else
+            derived_cache_.reset();
+
         const SpinGuard guard(lock_);
 
         data_ = that.data_;
+        refeed_subscriptions_(nullptr);
     }
     return (*this);
 }
@@ -76,6 +82,9 @@ DataFrame<I, H>::operator= (DataFrame &&that)  {
         indices_ = std::exchange(that.indices_, IndexVecType { });
         column_tb_ = std::exchange(that.column_tb_, ColNameDict { });
         column_list_ = std::exchange(that.column_list_, ColNameList { });
+        derived_cache_ = std::move(that.derived_cache_);
+        subscriptions_ = std::exchange(that.subscriptions_,
+                                       std::vector<Subscription> { });
 
         const SpinGuard guard(lock_);
 
@@ -135,6 +144,7 @@ sort_common_(DataFrame<I, H> &df, CF &&comp_func, bool ignore_index)  {
         iter.change(functor);
     if (! ignore_index)
         _sort_by_sorted_index_(df.indices_, sorting_idxs, idx_s);
+    df.touch_column(nullptr);
 }
 
 // ----------------------------------------------------------------------------
@@ -168,6 +178,7 @@ DataFrame<I, H>::shuffle(const StlVecType<const char *> &col_names,
         }
 
         data_[citer->second].change(functor);
+        touch_column(name_citer);
     }
 }
 
@@ -482,6 +493,8 @@ fill_missing(const StlVecType<const char *> &col_names,
 
     for (size_type idx = 0; idx < thread_count; ++idx)
         futures[idx].get();
+    for (size_type i = 0; i < count; ++i)
+        touch_column(col_names[i]);
     return;
 }
 
@@ -501,6 +514,7 @@ void DataFrame<I, H>::fill_missing (const DF &rhs)  {
 
         data_[col_citer.second].change(functor);
     }
+    touch_column(nullptr);
 
     return;
 }
@@ -566,6 +580,7 @@ drop_missing(drop_policy policy, size_type threshold)  {
 
     for (size_type idx = 0; idx < data_size; ++idx)
         data_[idx].change(functor2);
+    touch_column(nullptr);
 
     return;
 }
@@ -585,6 +600,7 @@ replace(const char *col_name,
 
     replace_vector_vals_<ColumnVecType<T>, T>
         (vec, old_values, new_values, count, limit);
+    touch_column(col_name);
 
     return (count);
 }
@@ -601,6 +617,8 @@ replace_index(const StlVecType<IndexType> &old_values,
 
     replace_vector_vals_<IndexVecType, IndexType>
         (indices_, old_values, new_values, count, limit);
+    if (count > 0)
+        touch_column(nullptr);
 
     return (count);
 }
@@ -617,6 +635,7 @@ replace(const char *col_name, F &functor)  {
 
     for (size_type i = 0; i < vec_s; ++i)
         if (! functor(indices_[i], vec[i]))  break;
+    touch_column(col_name);
 
     return;
 }
@@ -668,6 +687,7 @@ void DataFrame<I, H>::make_consistent ()  {
 
     for (const auto &iter : data_)
         iter.change(functor);
+    touch_column(nullptr);
 }
 
 // ----------------------------------------------------------------------------
@@ -687,6 +707,72 @@ void DataFrame<I, H>::shrink_to_fit ()  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+void DataFrame<I, H>::enable_derived_cache (bool enable)  {
+
+    if (! enable)
+        derived_cache_.reset();
+    else if (! derived_cache_)
+        derived_cache_ = std::make_unique<DerivedCache>();
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+const DerivedCache *DataFrame<I, H>::get_derived_cache () const  {
+
+    return (derived_cache_.get());
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::touch_column (const char *name)  {
+
+    if (derived_cache_)  derived_cache_->touch(name);
+    refeed_subscriptions_(name);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::appended_ (const char *name)  {
+
+    if (derived_cache_)  derived_cache_->touch(name);
+    for (auto &sub : subscriptions_)
+        sub.fed_cnt = sub.feed(*this, sub.fed_cnt);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+void DataFrame<I, H>::refeed_subscriptions_ (const char *name)  {
+
+    for (auto iter = subscriptions_.begin(); iter != subscriptions_.end(); )  {
+        bool    has_all = true;
+        bool    has_name = name == nullptr;
+
+        for (const auto &col_name : iter->col_names)  {
+            if (column_tb_.find(col_name.c_str()) == column_tb_.end())
+                has_all = false;
+            if (name && col_name == name)
+                has_name = true;
+        }
+        if (! has_name)  {
+            ++iter;
+            continue;
+        }
+        if (has_all)  {
+            iter->fed_cnt = iter->feed(*this, 0);
+            ++iter;
+        }
+        else
+            iter = subscriptions_.erase(iter);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T, typename ...Ts>
 void DataFrame<I, H>::
@@ -1493,6 +1579,73 @@ sort_async(const char *name1, sort_spec dir1,
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename I_V, typename ... Ts>
+void DataFrame<I, H>::
+groupby_common_(DataFrame &res,
+                I_V idx_visitor,
+                const StlVecType<size_type> &sort_v,
+                const StlVecType<size_type> &ends,
+                std::tuple<Ts ...> &args,
+                SpinGuard &guard) const  {
+
+    _groupby_aggregate_(indices_,
+                        indices_,
+                        sort_v,
+                        ends,
+                        idx_visitor,
+                        res.get_index());
+
+    // Create all the result columns first, so the result containers do not
+    // move while they are being filled
+    //
+    for_each_in_tuple (args,
+                       [&res](auto &triple) -> void  {
+                           _create_column_from_triple_(res, triple);
+                       });
+
+    // Each aggregation is an independent pass over its own column, writing
+    // to its own result column. Column references are resolved here, so the
+    // jobs don't touch any shared state
+    //
+    StlVecType<std::function<void()>>   jobs;
+
+    jobs.reserve(sizeof...(Ts));
+    for_each_in_tuple (
+        args,
+        [this, &res, &sort_v, &ends, &jobs](auto &triple) -> void  {
+            using TripleType = std::decay_t<decltype(triple)>;
+            using VisitorType = std::tuple_element_t<2, TripleType>;
+            using ValueType = typename VisitorType::value_type;
+            using ResultType = typename VisitorType::result_type;
+
+            const auto  &src_vec =
+                get_column<ValueType>(std::get<0>(triple), false);
+            auto        &dst_vec =
+                res.template get_column<ResultType>(std::get<1>(triple),
+                                                    false);
+            auto        &visitor = std::get<2>(triple);
+
+            jobs.emplace_back(
+                [this, &src_vec, &dst_vec, &visitor, &sort_v, &ends]() {
+                    _groupby_aggregate_(indices_,
+                                        src_vec,
+                                        sort_v,
+                                        ends,
+                                        visitor,
+                                        dst_vec);
+                });
+        });
+
+    // The visitors run on other threads, which would deadlock if they called
+    // anything that takes the lock. Everything shared is resolved by now.
+    //
+    guard.release();
+    _run_jobs_in_parallel_(jobs, get_thread_level());
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T, typename I_V, typename ... Ts>
 DataFrame<I, H> DataFrame<I, H>::
@@ -1505,35 +1658,81 @@ groupby1(const char *col_name, I_V &&idx_visitor, Ts&& ... args) const  {
     else
         gb_vec = (const ColumnVecType<T> *) &(get_column<T>(col_name));
 
-    StlVecType<std::size_t> sort_v (gb_vec->size(), 0);
+    // If the groupby column is already sorted, which is very common for
+    // time-based keys, we can aggregate the runs directly without the
+    // sorting permutation
+    //
+    StlVecType<size_type>   sort_v;
+
+    if (! std::is_sorted(gb_vec->begin(), gb_vec->end()))  {
+        sort_v.resize(gb_vec->size(), 0);
+        std::iota(sort_v.begin(), sort_v.end(), 0);
+        std::sort(sort_v.begin(), sort_v.end(),
+                  [gb_vec](std::size_t i, std::size_t j) -> bool  {
+                      return (gb_vec->at(i) < gb_vec->at(j));
+                  });
+    }
 
-    std::iota(sort_v.begin(), sort_v.end(), 0);
-    std::sort(sort_v.begin(), sort_v.end(),
-              [gb_vec](std::size_t i, std::size_t j) -> bool  {
-                  return (gb_vec->at(i) < gb_vec->at(j));
-              });
+    StlVecType<size_type>   ends;
+
+    _get_groupby_ends_(ends, sort_v, gb_vec->size(),
+                       [gb_vec](std::size_t i, std::size_t j) -> bool  {
+                           return ((*gb_vec)[i] != (*gb_vec)[j]);
+                       });
+
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+    SpinGuard       guard(lock_);
+
+    if (::strcmp(col_name, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec, sort_v, ends,
+                       res.template create_column<T>(col_name));
+    groupby_common_(res,
+                    std::forward<I_V>(idx_visitor),
+                    sort_v,
+                    ends,
+                    args_tuple,
+                    guard);
+    return (res);
+}
 
-    DataFrame   res;
-    auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [this,
-         &res,
-         gb_vec,
-         &sort_v,
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name](auto &triple) mutable -> void {
-            _load_groupby_data_1_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec,
-                                  sort_v,
-                                  col_name);
-        };
+// ----------------------------------------------------------------------------
 
-    const SpinGuard guard(lock_);
+template<typename I, typename H>
+template<typename T, typename I_V, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+groupby1_clustered(const char *col_name,
+                   I_V &&idx_visitor,
+                   Ts&& ... args) const  {
 
-    for_each_in_tuple (args_tuple, func);
+    const ColumnVecType<T>  *gb_vec { nullptr };
+
+    if (! ::strcmp(col_name, DF_INDEX_COL_NAME))
+        gb_vec = (const ColumnVecType<T> *) &(get_index());
+    else
+        gb_vec = (const ColumnVecType<T> *) &(get_column<T>(col_name));
+
+    const StlVecType<size_type> sort_v;
+    StlVecType<size_type>       ends;
+
+    _get_groupby_ends_(ends, sort_v, gb_vec->size(),
+                       [gb_vec](std::size_t i, std::size_t j) -> bool  {
+                           return ((*gb_vec)[i] != (*gb_vec)[j]);
+                       });
+
+    DataFrame       res;
+    auto            args_tuple = std::tuple<Ts ...>(args ...);
+    SpinGuard       guard(lock_);
+
+    if (::strcmp(col_name, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec, sort_v, ends,
+                       res.template create_column<T>(col_name));
+    groupby_common_(res,
+                    std::forward<I_V>(idx_visitor),
+                    sort_v,
+                    ends,
+                    args_tuple,
+                    guard);
     return (res);
 }
 
@@ -1549,7 +1748,7 @@ groupby2(const char *col_name1,
 
     const ColumnVecType<T1> *gb_vec1 { nullptr };
     const ColumnVecType<T2> *gb_vec2 { nullptr };
-    const SpinGuard         guard (lock_);
+    SpinGuard               guard (lock_);
 
     if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
         gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
@@ -1568,8 +1767,9 @@ groupby2(const char *col_name1,
             (const ColumnVecType<T2> *) &(get_column<T2>(col_name2, false));
     }
 
-    StlVecType<std::size_t> sort_v(
-        std::min(gb_vec1->size(), gb_vec2->size()), 0);
+    const size_type         vec_size =
+        std::min(gb_vec1->size(), gb_vec2->size());
+    StlVecType<std::size_t> sort_v(vec_size, 0);
 
     std::iota(sort_v.begin(), sort_v.end(), 0);
     std::sort(sort_v.begin(), sort_v.end(),
@@ -1581,29 +1781,30 @@ groupby2(const char *col_name1,
                   return (gb_vec2->at(i) < gb_vec2->at(j));
               });
 
+    StlVecType<size_type>   ends;
+
+    _get_groupby_ends_(ends, sort_v, vec_size,
+                       [gb_vec1, gb_vec2](std::size_t i,
+                                          std::size_t j) -> bool  {
+                           return ((*gb_vec1)[i] != (*gb_vec1)[j] ||
+                                   (*gb_vec2)[i] != (*gb_vec2)[j]);
+                       });
+
     DataFrame   res;
     auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [*this,
-         &res,
-         gb_vec1,
-         gb_vec2,
-         &sort_v,
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name1,
-         col_name2](auto &triple) mutable -> void {
-            _load_groupby_data_2_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec1,
-                                  *gb_vec2,
-                                  sort_v,
-                                  col_name1,
-                                  col_name2);
-        };
 
-    for_each_in_tuple (args_tuple, func);
+    if (::strcmp(col_name1, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec1, sort_v, ends,
+                       res.template create_column<T1>(col_name1));
+    if (::strcmp(col_name2, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec2, sort_v, ends,
+                       res.template create_column<T2>(col_name2));
+    groupby_common_(res,
+                    std::forward<I_V>(idx_visitor),
+                    sort_v,
+                    ends,
+                    args_tuple,
+                    guard);
     return (res);
 }
 
@@ -1621,7 +1822,7 @@ groupby3(const char *col_name1,
     const ColumnVecType<T1> *gb_vec1 { nullptr };
     const ColumnVecType<T2> *gb_vec2 { nullptr };
     const ColumnVecType<T3> *gb_vec3 { nullptr };
-    const SpinGuard         guard (lock_);
+    SpinGuard               guard (lock_);
 
     if (! ::strcmp(col_name1, DF_INDEX_COL_NAME))  {
         gb_vec1 = (const ColumnVecType<T1> *) &(get_index());
@@ -1654,8 +1855,9 @@ groupby3(const char *col_name1,
             (const ColumnVecType<T3> *) &(get_column<T3>(col_name3, false));
     }
 
-    StlVecType<std::size_t> sort_v(
-        std::min({ gb_vec1->size(), gb_vec2->size(), gb_vec3->size() }), 0);
+    const size_type         vec_size =
+        std::min({ gb_vec1->size(), gb_vec2->size(), gb_vec3->size() });
+    StlVecType<std::size_t> sort_v(vec_size, 0);
 
     std::iota(sort_v.begin(), sort_v.end(), 0);
     std::sort(sort_v.begin(), sort_v.end(),
@@ -1672,33 +1874,34 @@ groupby3(const char *col_name1,
                   return (gb_vec3->at(i) < gb_vec3->at(j));
               });
 
+    StlVecType<size_type>   ends;
+
+    _get_groupby_ends_(ends, sort_v, vec_size,
+                       [gb_vec1, gb_vec2, gb_vec3](std::size_t i,
+                                                   std::size_t j) -> bool  {
+                           return ((*gb_vec1)[i] != (*gb_vec1)[j] ||
+                                   (*gb_vec2)[i] != (*gb_vec2)[j] ||
+                                   (*gb_vec3)[i] != (*gb_vec3)[j]);
+                       });
+
     DataFrame   res;
     auto        args_tuple = std::tuple<Ts ...>(args ...);
-    auto        func =
-        [*this,
-         &res,
-         gb_vec1,
-         gb_vec2,
-         gb_vec3,
-         &sort_v,
-         idx_visitor = std::forward<I_V>(idx_visitor),
-         col_name1,
-         col_name2,
-         col_name3](auto &triple) mutable -> void {
-            _load_groupby_data_3_(*this,
-                                  res,
-                                  triple,
-                                  idx_visitor,
-                                  *gb_vec1,
-                                  *gb_vec2,
-                                  *gb_vec3,
-                                  sort_v,
-                                  col_name1,
-                                  col_name2,
-                                  col_name3);
-        };
 
-    for_each_in_tuple (args_tuple, func);
+    if (::strcmp(col_name1, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec1, sort_v, ends,
+                       res.template create_column<T1>(col_name1));
+    if (::strcmp(col_name2, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec2, sort_v, ends,
+                       res.template create_column<T2>(col_name2));
+    if (::strcmp(col_name3, DF_INDEX_COL_NAME))
+        _groupby_keys_(*gb_vec3, sort_v, ends,
+                       res.template create_column<T3>(col_name3));
+    groupby_common_(res,
+                    std::forward<I_V>(idx_visitor),
+                    sort_v,
+                    ends,
+                    args_tuple,
+                    guard);
     return (res);
 }
 
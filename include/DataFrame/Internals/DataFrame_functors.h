@@ -275,6 +275,12 @@ struct mod_by_idx_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
+// The join and selection functors don't gather the columns themselves.
+// They add a gather job, which may run in parallel, and a load job, which
+// loads the gathered column into result after all the gather jobs are done.
+//
+using ColumnJobVector = StlVecType<std::function<void()>>;
+
 template<typename RES_T, typename ... Ts>
 struct  index_join_functor_common_ : DataVec::template visitor_base<Ts ...>  {
 
@@ -282,13 +288,18 @@ struct  index_join_functor_common_ : DataVec::template visitor_base<Ts ...>  {
         const char *n,
         const DataFrame &r,
         const IndexIdxVector &mii,
-        RES_T &res)
-        : name(n), rhs(r), joined_index_idx(mii), result(res)  {  }
+        RES_T &res,
+        ColumnJobVector &gj,
+        ColumnJobVector &lj)
+        : name(n), rhs(r), joined_index_idx(mii), result(res),
+          gather_jobs(gj), load_jobs(lj)  {  }
 
     const char              *name;
     const DataFrame         &rhs;
     const IndexIdxVector    &joined_index_idx;
     RES_T                   &result;
+    ColumnJobVector         &gather_jobs;
+    ColumnJobVector         &load_jobs;
 
     template<typename T>
     void operator() (const T &lhs_vec);
@@ -304,12 +315,17 @@ struct  index_join_functor_oneside_
     inline index_join_functor_oneside_ (
         const char *n,
         const IndexIdxVector &mii,
-        RES_T &res)
-        : name(n), joined_index_idx(mii), result(res)  {  }
+        RES_T &res,
+        ColumnJobVector &gj,
+        ColumnJobVector &lj)
+        : name(n), joined_index_idx(mii), result(res),
+          gather_jobs(gj), load_jobs(lj)  {  }
 
     const char              *name;
     const IndexIdxVector    &joined_index_idx;
     RES_T                   &result;
+    ColumnJobVector         &gather_jobs;
+    ColumnJobVector         &load_jobs;
 
     template<typename T>
     void operator() (const T &vec);
@@ -317,6 +333,88 @@ struct  index_join_functor_oneside_
 
 // ----------------------------------------------------------------------------
 
+// It presents an already sorted column as a vector of JoinSortingPair, so it
+// can be merged without copying or sorting it
+//
+template<typename V>
+struct  SortedJoinView_  {
+
+    using value_type = JoinSortingPair<typename V::value_type>;
+
+    inline SortedJoinView_ (const V &v) : vec(v)  {  }
+
+    inline size_type size() const  { return (vec.size()); }
+    inline value_type operator[] (size_type i) const  {
+
+        return (value_type(&(vec[i]), i));
+    }
+
+    const V &vec;
+};
+
+// ----------------------------------------------------------------------------
+
+// It presents two or three key columns as one vector of tuples, without
+// copying them into a combined key column. Its size is the size of the
+// shortest column
+//
+template<typename ... Vs>
+struct  MultiKeyVec_  {
+
+    using value_type = std::tuple<const typename Vs::value_type & ...>;
+
+    inline MultiKeyVec_ (const Vs & ... vs)
+        : cols(vs ...), vec_s(std::min({ vs.size() ... }))  {  }
+
+    inline size_type size() const  { return (vec_s); }
+    inline value_type operator[] (size_type i) const  {
+
+        return (std::apply(
+                    [i](const Vs & ... vs) -> value_type  {
+                        return (value_type(vs[i] ...));
+                    },
+                    cols));
+    }
+
+    const std::tuple<const Vs & ...>    cols;
+    const size_type                     vec_s;
+};
+
+// ----------------------------------------------------------------------------
+
+// It presents the keys in the order of the given row numbers as a vector of
+// JoinSortingPair-like pairs. The first of each pair is a small wrapper that
+// dereferences to the key, because keys like those of MultiKeyVec_ are not
+// stored anywhere to point to
+//
+template<typename K>
+struct  RowsJoinView_  {
+
+    struct  KeyRef  {
+
+        inline const typename K::value_type &
+        operator* () const  { return (key); }
+
+        const typename K::value_type    key;
+    };
+
+    using value_type = std::pair<KeyRef, size_type>;
+
+    inline RowsJoinView_ (const K &k, const StlVecType<size_type> &r)
+        : keys(k), rows(r)  {  }
+
+    inline size_type size() const  { return (rows.size()); }
+    inline value_type operator[] (size_type i) const  {
+
+        return (value_type(KeyRef { keys[rows[i]] }, rows[i]));
+    }
+
+    const K                     &keys;
+    const StlVecType<size_type> &rows;
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename RES_T, typename ... Ts>
 struct  concat_functor_ : DataVec::template visitor_base<Ts ...>  {
 
@@ -474,6 +572,31 @@ struct sel_load_functor_ : DataVec::template visitor_base<Ts ...>  {
 
 // ----------------------------------------------------------------------------
 
+template<typename IT, typename DF, typename ... Ts>
+struct sel_gather_functor_ : DataVec::template visitor_base<Ts ...>  {
+
+    inline sel_gather_functor_ (const char *n,
+                                const StlVecType<IT> &si,
+                                size_type is,
+                                DF &d,
+                                ColumnJobVector &gj,
+                                ColumnJobVector &lj)
+        : name (n), sel_indices (si), indices_size(is), df(d),
+          gather_jobs(gj), load_jobs(lj)  {   }
+
+    const char              *name;
+    const StlVecType<IT>    &sel_indices;
+    const size_type         indices_size;
+    DF                      &df;
+    ColumnJobVector         &gather_jobs;
+    ColumnJobVector         &load_jobs;
+
+    template<typename T>
+    void operator() (const T &vec);
+};
+
+// ----------------------------------------------------------------------------
+
 template<typename IT, typename DF, typename ... Ts>
 struct sel_load_view_functor_ : DataVec::template visitor_base<Ts ...>  {
 
@@ -512,10 +635,14 @@ struct concat_load_view_functor_ : DataVec::template visitor_base<Ts ...>  {
 template<typename ... Ts>
 struct sel_remove_functor_ : DataVec::template visitor_base<Ts ...>  {
 
-    inline sel_remove_functor_ (const StlVecType<size_type> &si)
-        : sel_indices (si)  {   }
+    // If jobs is given, the removals are added to it to run later
+    //
+    inline sel_remove_functor_ (const StlVecType<size_type> &si,
+                                ColumnJobVector *j = nullptr)
+        : sel_indices (si), jobs(j)  {   }
 
     const StlVecType<size_type>    &sel_indices;
+    ColumnJobVector                *jobs;
 
     template<typename T>
     void operator() (T &vec) const;
@@ -632,11 +759,16 @@ struct fill_missing_functor_ :
 template<typename ... Ts>
 struct describe_functor_ : DataVec::template visitor_base<Ts ...>  {
 
-    inline describe_functor_ (const char *n, DataFrame<std::string, H> &r)
-        : name(n), result(r)  {  }
+    inline describe_functor_ (const char *n,
+                              DataFrame<std::string, H> &r,
+                              ColumnJobVector &sj,
+                              ColumnJobVector &lj)
+        : name(n), result(r), stats_jobs(sj), load_jobs(lj)  {  }
 
     const char                  *name;
     DataFrame<std::string, H>   &result;
+    ColumnJobVector             &stats_jobs;
+    ColumnJobVector             &load_jobs;
 
     template<typename T>
     void operator() (const T &vec);
@@ -31,6 +31,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrameStatsVisitors.h>
 
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <random>
 #include <unordered_set>
@@ -854,41 +855,430 @@ get_view_by_loc (const StlVecType<long> &locations) const  {
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename T, typename F, typename ... Ts>
+template<typename ... Ts>
 DataFrame<I, H> DataFrame<I, H>::
-get_data_by_sel (const char *name, F &sel_functor) const  {
+data_by_sel_common_ (const StlVecType<size_type> &col_indices) const  {
 
-    const ColumnVecType<T>  &vec = get_column<T>(name);
-    const size_type         idx_s = indices_.size();
-    const size_type         col_s = vec.size();
-    StlVecType<size_type>  col_indices;
+    return (data_by_sel_cols_<DataFrame, Ts ...>(col_indices, { }));
+}
 
-    col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)
-        if (sel_functor (indices_[i], vec[i]))
-            col_indices.push_back(i);
+// ----------------------------------------------------------------------------
 
-    DataFrame       df;
-    IndexVecType    new_index;
+template<typename I, typename H>
+template<typename DF, typename ... Ts>
+DF DataFrame<I, H>::
+data_by_sel_cols_ (const StlVecType<size_type> &col_indices,
+                   const StlVecType<const char *> &col_names) const  {
+
+    const size_type             idx_s = indices_.size();
+    DF                          df;
+    typename DF::IndexVecType   new_index;
 
     new_index.reserve(col_indices.size());
     for (auto citer: col_indices)
         new_index.push_back(indices_[citer]);
     df.load_index(std::move(new_index));
 
+    ColumnJobVector gather_jobs;
+    ColumnJobVector load_jobs;
     const SpinGuard guard(lock_);
 
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
+    if (col_names.empty())  {
+        for (const auto &col_citer : column_list_)  {
+            sel_gather_functor_<size_type, DF, Ts ...>  functor (
+                col_citer.first.c_str(),
+                col_indices,
+                idx_s,
+                df,
+                gather_jobs,
+                load_jobs);
+
+            data_[col_citer.second].change(functor);
+        }
+    }
+    else  {
+        for (const char *col_name : col_names)  {
+            if (! ::strcmp(col_name, DF_INDEX_COL_NAME))  continue;
+
+            const auto  citer = column_tb_.find(col_name);
+
+            if (citer == column_tb_.end())  {
+                char buffer [512];
+
+                snprintf(buffer, sizeof(buffer) - 1,
+                         "DataFrame::data_by_sel_cols_(): ERROR: "
+                         "Cannot find column '%s'",
+                         col_name);
+                throw ColNotFound(buffer);
+            }
+
+            sel_gather_functor_<size_type, DF, Ts ...>  functor (
+                col_name,
+                col_indices,
+                idx_s,
+                df,
+                gather_jobs,
+                load_jobs);
+
+            data_[citer->second].change(functor);
+        }
+    }
+
+    // The columns are gathered in parallel, but loaded into df one at a
+    // time, in column order
+    //
+    _run_jobs_in_parallel_(gather_jobs, get_thread_level());
+    for (auto &job : load_jobs)  job();
+    return (df);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename V, typename DF, typename ... Ts>
+V DataFrame<I, H>::
+view_by_sel_common_ (DF &df, const StlVecType<size_type> &col_indices)  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can have a PtrView");
+
+    const size_type             idx_s = df.indices_.size();
+    V                           dfv;
+    typename V::IndexVecType    new_index;
+
+    new_index.reserve(col_indices.size());
+    for (auto citer: col_indices)
+        new_index.push_back(&(df.indices_[citer]));
+    dfv.indices_ = std::move(new_index);
+
+    const SpinGuard guard(lock_);
+
+    for (const auto &col_citer : df.column_list_)  {
+        sel_load_view_functor_<size_type, V, Ts ...>    functor (
             col_citer.first.c_str(),
             col_indices,
             idx_s,
-            df);
+            dfv);
 
-        data_[col_citer.second].change(functor);
+        df.data_[col_citer.second].change(functor);
     }
 
-    return (df);
+    return (dfv);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename F>
+void DataFrame<I, H>::
+sel_col_bitmap_(const char *col_name,
+                const F &test,
+                SelBitmap &bits,
+                SelBitmap &not_bits) const  {
+
+    size_type   col_s = indices_.size();
+
+    if (! ::strcmp(col_name, DF_INDEX_COL_NAME))  {
+        if constexpr (std::is_same<T, IndexType>::value)
+            _sel_bitmap_(indices_, indices_.size(), test, bits,
+                         get_thread_level());
+        else
+            throw NotFeasible("sel_col_bitmap_(): "
+                              "To select on index, T must be IndexType");
+    }
+    else  {
+        const ColumnVecType<T>  &vec = get_column<T>(col_name);
+
+        col_s = std::min(vec.size(), col_s);
+        _sel_bitmap_(vec, indices_.size(), test, bits, get_thread_level());
+    }
+
+    // A row is false only if the column has a value for it
+    //
+    const size_type full_words = col_s / 64;
+    const size_type tail = col_s % 64;
+
+    for (size_type w = 0; w < full_words; ++w)
+        not_bits[w] = ~bits[w];
+    if (tail)
+        not_bits[full_words] =
+            ~bits[full_words] & ((std::uint64_t(1) << tail) - 1);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+sel_bitmap_(const SelCompare<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    const T &v = pred.value;
+
+    switch (pred.op)  {
+        case compare_op::eq:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x == v); },
+                               bits, not_bits);
+            break;
+        case compare_op::ne:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x != v); },
+                               bits, not_bits);
+            break;
+        case compare_op::lt:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x < v); },
+                               bits, not_bits);
+            break;
+        case compare_op::le:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x <= v); },
+                               bits, not_bits);
+            break;
+        case compare_op::gt:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x > v); },
+                               bits, not_bits);
+            break;
+        case compare_op::ge:
+        default:
+            sel_col_bitmap_<T>(pred.col_name,
+                               [&v](const T &x) -> bool { return (x >= v); },
+                               bits, not_bits);
+            break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+sel_bitmap_(const SelRange<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    const T &low = pred.low;
+    const T &high = pred.high;
+
+    sel_col_bitmap_<T>(pred.col_name,
+                       [&low, &high](const T &x) -> bool  {
+                           return ((! (x < low)) & (x < high));
+                       },
+                       bits, not_bits);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::
+sel_bitmap_(const SelIn<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    // Short lists are scanned. Longer lists are sorted and searched.
+    //
+    if (pred.values.size() <= 8)  {
+        const auto  &values = pred.values;
+
+        sel_col_bitmap_<T>(pred.col_name,
+                           [&values](const T &x) -> bool  {
+                               bool    found = false;
+
+                               for (const auto &v : values)
+                                   found |= (x == v);
+                               return (found);
+                           },
+                           bits, not_bits);
+    }
+    else  {
+        std::vector<T>  values = pred.values;
+
+        std::sort(values.begin(), values.end());
+        sel_col_bitmap_<T>(pred.col_name,
+                           [&values](const T &x) -> bool  {
+                               return (std::binary_search(values.begin(),
+                                                          values.end(), x));
+                           },
+                           bits, not_bits);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename F>
+void DataFrame<I, H>::
+sel_bitmap_(const SelFunctor<T, F> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    const F &functor = pred.functor;
+
+    sel_col_bitmap_<T>(pred.col_name,
+                       [&functor](const T &x) -> bool  {
+                           return (functor(x));
+                       },
+                       bits, not_bits);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename L, typename R>
+void DataFrame<I, H>::
+sel_bitmap_(const SelAnd<L, R> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    SelBitmap   rhs_bits (bits.size(), 0);
+    SelBitmap   rhs_not_bits (bits.size(), 0);
+
+    sel_bitmap_(pred.lhs, bits, not_bits);
+    sel_bitmap_(pred.rhs, rhs_bits, rhs_not_bits);
+    for (size_type w = 0; w < bits.size(); ++w)  {
+        bits[w] &= rhs_bits[w];
+        not_bits[w] |= rhs_not_bits[w];
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename L, typename R>
+void DataFrame<I, H>::
+sel_bitmap_(const SelOr<L, R> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    SelBitmap   rhs_bits (bits.size(), 0);
+    SelBitmap   rhs_not_bits (bits.size(), 0);
+
+    sel_bitmap_(pred.lhs, bits, not_bits);
+    sel_bitmap_(pred.rhs, rhs_bits, rhs_not_bits);
+    for (size_type w = 0; w < bits.size(); ++w)  {
+        bits[w] |= rhs_bits[w];
+        not_bits[w] &= rhs_not_bits[w];
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P>
+void DataFrame<I, H>::
+sel_bitmap_(const SelNot<P> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const  {
+
+    // Rows past the end of a column are in neither bitmap, so they stay
+    // unmatched
+    //
+    sel_bitmap_(pred.pred, not_bits, bits);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P>
+typename DataFrame<I, H>::SelBitmap DataFrame<I, H>::
+pred_bitmap_(const P &pred) const  {
+
+    static_assert(is_sel_pred<P>::value,
+                  "pred must be built from sel_col() (See SelCompare)");
+
+    SelBitmap   bits ((indices_.size() + 63) / 64, 0);
+    SelBitmap   not_bits (bits.size(), 0);
+
+    sel_bitmap_(pred, bits, not_bits);
+    return (bits);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+get_data_by_pred(const P &pred) const  {
+
+    StlVecType<size_type>   col_indices;
+
+    _bitmap_rows_(pred_bitmap_(pred), col_indices);
+    return (data_by_sel_common_<Ts ...>(col_indices));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P, typename ... Ts>
+typename DataFrame<I, H>::PtrView DataFrame<I, H>::
+get_view_by_pred(const P &pred)  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can call get_view_by_pred()");
+
+    StlVecType<size_type>   col_indices;
+
+    _bitmap_rows_(pred_bitmap_(pred), col_indices);
+    return (view_by_sel_common_<PtrView, DataFrame, Ts ...>
+                (*this, col_indices));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P, typename ... Ts>
+typename DataFrame<I, H>::ConstPtrView DataFrame<I, H>::
+get_view_by_pred(const P &pred) const  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, H>::value,
+                  "Only a StdDataFrame can call get_view_by_pred()");
+
+    StlVecType<size_type>   col_indices;
+
+    _bitmap_rows_(pred_bitmap_(pred), col_indices);
+    return (view_by_sel_common_<ConstPtrView, const DataFrame, Ts ...>
+                (*this, col_indices));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P>
+typename DataFrame<I, H>::size_type DataFrame<I, H>::
+count_by_pred(const P &pred) const  {
+
+    size_type   count = 0;
+
+    for (const std::uint64_t word : pred_bitmap_(pred))
+        count += _popcount64_(word);
+    return (count);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename F, typename ... Ts>
+DataFrame<I, H> DataFrame<I, H>::
+get_data_by_sel (const char *name, F &sel_functor) const  {
+
+    const ColumnVecType<T>  &vec = get_column<T>(name);
+    const size_type         idx_s = indices_.size();
+    const size_type         col_s = vec.size();
+    StlVecType<size_type>  col_indices;
+
+    col_indices.reserve(idx_s / 2);
+    _sel_rows_(0, col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
+
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -999,34 +1389,19 @@ get_data_by_sel (const char *name1, const char *name2, F &sel_functor) const  {
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i], vec1[i], vec2[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
                          i < col_s2 ? vec2[i] : get_nan<T2>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1156,9 +1531,13 @@ get_data_by_sel (const char *name1,
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                       vec3[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1166,25 +1545,7 @@ get_data_by_sel (const char *name1,
                          i < col_s3 ? vec3[i] : get_nan<T3>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1213,43 +1574,25 @@ get_data_by_sel (F &sel_functor) const  {
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)  {
-        std::apply(
-            [&](auto && ... col)  {
-                if (sel_functor(indices_[i],
-                                (i < col.size() ?
-                                 col[i] :
-                                 // Get default value based on vec::value_type
-                                 get_nan<typename std::decay<decltype(col)>
-                                 ::type::value_type>())...))  {
-                    col_indices.push_back(i);
-                }
-            },
-            cols_for_filter);
-    }
-
-    // Get the records based on indices
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    const SpinGuard guard(lock_);
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Tuple>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    _sel_rows_(
+        0, col_s,
+        [&](size_type i) -> bool  {
+            return (std::apply(
+                [&](auto && ... col) -> bool  {
+                    return (sel_functor(
+                        indices_[i],
+                        (i < col.size() ?
+                         col[i] :
+                         // Get default value based on vec::value_type
+                         get_nan<typename std::decay<decltype(col)>
+                         ::type::value_type>())...));
+                },
+                cols_for_filter));
+        },
+        col_indices,
+        sel_thread_level_<F>());
+
+    return (data_by_sel_common_<Tuple>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1278,41 +1621,24 @@ get_data_by_sel (F &sel_functor, FilterCols && ... filter_cols) const  {
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < col_s; ++i)  {
-        std::apply(
-            [&](auto&&... col) {
-                if (sel_functor(indices_[i],
-                                (i < col.size() ?
-                                 col[i] :
-                                 get_nan<typename std::decay<decltype(col)>
-                                 ::type::value_type>())...))
-                    col_indices.push_back(i);
-            },
-            cols_for_filter);
-    }
-
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    // Get the records based on indices
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    const SpinGuard guard(lock_);
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Tuple>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    _sel_rows_(
+        0, col_s,
+        [&](size_type i) -> bool  {
+            return (std::apply(
+                [&](auto&&... col) -> bool  {
+                    return (sel_functor(
+                        indices_[i],
+                        (i < col.size() ?
+                         col[i] :
+                         get_nan<typename std::decay<decltype(col)>
+                         ::type::value_type>())...));
+                },
+                cols_for_filter));
+        },
+        col_indices,
+        sel_thread_level_<F>());
+
+    return (data_by_sel_common_<Tuple>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1459,9 +1785,13 @@ get_data_by_sel(const char *name1,
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i], vec4[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i],
+                                       vec4[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1470,25 +1800,7 @@ get_data_by_sel(const char *name1,
                         i < col_s4 ? vec4[i] : get_nan<T4>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1650,10 +1962,13 @@ get_data_by_sel(const char *name1,
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor(indices_[i],
-                        vec1[i], vec2[i], vec3[i], vec4[i], vec5[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i], vec3[i],
+                                       vec4[i], vec5[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor(indices_[i],
                         i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1663,25 +1978,7 @@ get_data_by_sel(const char *name1,
                         i < col_s5 ? vec5[i] : get_nan<T5>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1757,25 +2054,7 @@ get_data_by_sel(const char *name1,
                         i < col_s11 ? vec11[i] : get_nan<T11>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1855,25 +2134,7 @@ get_data_by_sel(const char *name1,
                         i < col_s12 ? vec12[i] : get_nan<T12>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -1957,25 +2218,7 @@ get_data_by_sel(const char *name1,
                         i < col_s13 ? vec13[i] : get_nan<T13>()))
             col_indices.push_back(i);
 
-    DataFrame       df;
-    IndexVecType    new_index;
-
-    new_index.reserve(col_indices.size());
-    for (auto citer: col_indices)
-        new_index.push_back(indices_[citer]);
-    df.load_index(std::move(new_index));
-
-    for (const auto &col_citer : column_list_)  {
-        sel_load_functor_<size_type, Ts ...>    functor (
-            col_citer.first.c_str(),
-            col_indices,
-            idx_s,
-            df);
-
-        data_[col_citer.second].change(functor);
-    }
-
-    return (df);
+    return (data_by_sel_common_<Ts ...>(col_indices));
 }
 
 // ----------------------------------------------------------------------------
@@ -2634,14 +2877,24 @@ DataFrame<I, H>::describe() const  {
 
     result.load_index(describe_index_col.begin(), describe_index_col.end());
 
+    ColumnJobVector stats_jobs;
+    ColumnJobVector load_jobs;
     const SpinGuard guard(lock_);
 
     for (const auto &citer : column_list_)  {
-        describe_functor_<Ts ...>   functor (citer.first.c_str(), result);
+        describe_functor_<Ts ...>   functor (citer.first.c_str(),
+                                             result,
+                                             stats_jobs,
+                                             load_jobs);
 
         data_[citer.second].change(functor);
     }
 
+    // Each column is described in one pass, columns in parallel. They are
+    // loaded into result in column order.
+    //
+    _run_jobs_in_parallel_(stats_jobs, get_thread_level());
+    for (auto &job : load_jobs)  job();
     return (result);
 }
 
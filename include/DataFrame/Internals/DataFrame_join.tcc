@@ -30,6 +30,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrame.h>
 
 #include <cstdio>
+#include <cstring>
+#include <numeric>
 
 // ----------------------------------------------------------------------------
 
@@ -40,7 +42,7 @@ template<typename I, typename H>
 template<typename RHS_T, typename ... Ts>
 DataFrame<I, H>
 DataFrame<I, H>::
-join_by_index (const RHS_T &rhs, join_policy mp) const  {
+join_by_index (const RHS_T &rhs, join_policy mp, join_algorithm ja) const  {
 
     static_assert(
         std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
@@ -50,56 +52,52 @@ join_by_index (const RHS_T &rhs, join_policy mp) const  {
         "The rhs argument to join_by_index() can only be "
         "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
 
-    const auto                              &lhs_idx = get_index();
-    const auto                              &rhs_idx = rhs.get_index();
-    const size_type                         lhs_idx_s = lhs_idx.size();
-    const size_type                         rhs_idx_s = rhs_idx.size();
-    StlVecType<JoinSortingPair<IndexType>>  idx_vec_lhs;
-    StlVecType<JoinSortingPair<IndexType>>  idx_vec_rhs;
+    return (index_join_helper_<decltype(*this), RHS_T, Ts ...>
+                (*this, rhs,
+                 get_join_index_idx_vector_<IndexType>(get_index(),
+                                                       rhs.get_index(),
+                                                       mp, ja)));
+}
 
-    idx_vec_lhs.reserve(lhs_idx_s);
-    for (size_type i = 0; i < lhs_idx_s; ++i)
-        idx_vec_lhs.push_back(std::make_pair(&(lhs_idx[i]), i));
-    idx_vec_rhs.reserve(rhs_idx_s);
-    for (size_type i = 0; i < rhs_idx_s; ++i)
-        idx_vec_rhs.push_back(std::make_pair(&(rhs_idx[i]), i));
+// ----------------------------------------------------------------------------
 
-    auto    cf = [] (const JoinSortingPair<IndexType> &l,
-                     const JoinSortingPair<IndexType> &r) -> bool  {
-                     return (*(l.first) < *(r.first));
-                 };
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+DataFrame<unsigned int, H>
+DataFrame<I, H>::
+join_by_column (const RHS_T &rhs,
+                const char *name,
+                join_policy mp,
+                join_algorithm ja) const  {
 
-    std::sort(idx_vec_lhs.begin(), idx_vec_lhs.end(), cf);
-    std::sort(idx_vec_rhs.begin(), idx_vec_rhs.end(), cf);
+    static_assert(
+        std::is_base_of<
+            DataFrame<I,
+                      HeteroVector<std::size_t(H::align_value)>>,
+                      RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_by_column() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
 
-    switch(mp)  {
-        case join_policy::inner_join:
-            return (index_inner_join_
-                        <decltype(*this), RHS_T, Ts ...>
-                    (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::left_join:
-            return (index_left_join_
-                        <decltype(*this), RHS_T, Ts ...>
-                    (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::right_join:
-            return (index_right_join_
-                        <decltype(*this), RHS_T, Ts ...>
-                    (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-        case join_policy::left_right_join:
-        default:
-            return (index_left_right_join_
-                        <decltype(*this), RHS_T, Ts ...>
-                    (*this, rhs, idx_vec_lhs, idx_vec_rhs));
-    }
+    return (column_join_helper_<decltype(*this), RHS_T, T, Ts ...>
+                (*this, rhs, name,
+                 get_join_index_idx_vector_<T>(get_column<T>(name),
+                                               rhs.template get_column<T>(name),
+                                               mp, ja)));
 }
 
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename RHS_T, typename T, typename ... Ts>
+template<typename RHS_T, typename T1, typename T2, typename ... Ts>
 DataFrame<unsigned int, H>
 DataFrame<I, H>::
-join_by_column (const RHS_T &rhs, const char *name, join_policy mp) const  {
+join_by_column (const RHS_T &rhs,
+                const char *name1,
+                const char *name2,
+                join_policy mp,
+                join_algorithm ja) const  {
 
     static_assert(
         std::is_base_of<
@@ -111,48 +109,539 @@ join_by_column (const RHS_T &rhs, const char *name, join_policy mp) const  {
         "The rhs argument to join_by_column() can only be "
         "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
 
-    const auto      &lhs_vec = get_column<T>(name);
-    const auto      &rhs_vec = rhs.template get_column<T>(name);
-    const size_type lhs_vec_s = lhs_vec.size();
-    const size_type rhs_vec_s = rhs_vec.size();
+    const MultiKeyVec_  lhs_keys (get_column<T1>(name1),
+                                  get_column<T2>(name2));
+    const MultiKeyVec_  rhs_keys (rhs.template get_column<T1>(name1),
+                                  rhs.template get_column<T2>(name2));
+    const auto          joined_index_idx =
+        get_multi_key_index_idx_vector_(lhs_keys, rhs_keys, mp, ja);
+    auto                result =
+        column_join_result_(*this, rhs, joined_index_idx);
+
+    join_key_column_<decltype(*this), RHS_T, T1>
+        (*this, rhs, name1, joined_index_idx, result);
+    join_key_column_<decltype(*this), RHS_T, T2>
+        (*this, rhs, name2, joined_index_idx, result);
+    join_helper_common_<decltype(*this), RHS_T, unsigned int, Ts ...>
+        (*this, rhs, joined_index_idx, result, { name1, name2 });
+    return (result);
+}
 
-    StlVecType<JoinSortingPair<T>>  col_vec_lhs;
-    StlVecType<JoinSortingPair<T>>  col_vec_rhs;
+// ----------------------------------------------------------------------------
 
-    col_vec_lhs.reserve(lhs_vec_s);
-    for (size_type i = 0; i < lhs_vec_s; ++i)
-        col_vec_lhs.push_back(std::make_pair(&(lhs_vec[i]), i));
-    col_vec_rhs.reserve(rhs_vec_s);
-    for (size_type i = 0; i < rhs_vec_s; ++i)
-        col_vec_rhs.push_back(std::make_pair(&(rhs_vec[i]), i));
+template<typename I, typename H>
+template<typename RHS_T, typename T1, typename T2, typename T3,
+         typename ... Ts>
+DataFrame<unsigned int, H>
+DataFrame<I, H>::
+join_by_column (const RHS_T &rhs,
+                const char *name1,
+                const char *name2,
+                const char *name3,
+                join_policy mp,
+                join_algorithm ja) const  {
 
-    auto    cf = [] (const JoinSortingPair<T> &l,
-                     const JoinSortingPair<T> &r) -> bool  {
-                     return (*(l.first) < *(r.first));
-                 };
+    static_assert(
+        std::is_base_of<
+            DataFrame<I,
+                      HeteroVector<std::size_t(H::align_value)>>,
+                      RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_by_column() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
 
-    std::sort(col_vec_lhs.begin(), col_vec_lhs.end(), cf);
-    std::sort(col_vec_rhs.begin(), col_vec_rhs.end(), cf);
+    const MultiKeyVec_  lhs_keys (get_column<T1>(name1),
+                                  get_column<T2>(name2),
+                                  get_column<T3>(name3));
+    const MultiKeyVec_  rhs_keys (rhs.template get_column<T1>(name1),
+                                  rhs.template get_column<T2>(name2),
+                                  rhs.template get_column<T3>(name3));
+    const auto          joined_index_idx =
+        get_multi_key_index_idx_vector_(lhs_keys, rhs_keys, mp, ja);
+    auto                result =
+        column_join_result_(*this, rhs, joined_index_idx);
+
+    join_key_column_<decltype(*this), RHS_T, T1>
+        (*this, rhs, name1, joined_index_idx, result);
+    join_key_column_<decltype(*this), RHS_T, T2>
+        (*this, rhs, name2, joined_index_idx, result);
+    join_key_column_<decltype(*this), RHS_T, T3>
+        (*this, rhs, name3, joined_index_idx, result);
+    join_helper_common_<decltype(*this), RHS_T, unsigned int, Ts ...>
+        (*this, rhs, joined_index_idx, result, { name1, name2, name3 });
+    return (result);
+}
 
-    switch(mp)  {
-        case join_policy::inner_join:
-            return (column_inner_join_
-                        <decltype(*this), RHS_T, T, Ts ...>
-                            (*this, rhs, name, col_vec_lhs, col_vec_rhs));
-        case join_policy::left_join:
-            return (column_left_join_
-                        <decltype(*this), RHS_T, T, Ts ...>
-                            (*this, rhs, name, col_vec_lhs, col_vec_rhs));
-        case join_policy::right_join:
-            return (column_right_join_
-                        <decltype(*this), RHS_T, T, Ts ...>
-                            (*this, rhs, name, col_vec_lhs, col_vec_rhs));
-        case join_policy::left_right_join:
-        default:
-            return (column_left_right_join_
-                        <decltype(*this), RHS_T, T, Ts ...>
-                            (*this, rhs, name, col_vec_lhs, col_vec_rhs));
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::
+join_asof(const RHS_T &rhs, asof_policy ap, double tolerance) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_asof() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    const auto      &lhs_idx = get_index();
+    const auto      &rhs_idx = rhs.get_index();
+    const size_type lhs_idx_s = lhs_idx.size();
+    const size_type rhs_idx_s = rhs_idx.size();
+
+    if (! std::is_sorted(lhs_idx.begin(), lhs_idx.end()) ||
+        ! std::is_sorted(rhs_idx.begin(), rhs_idx.end()))
+        throw NotFeasible("join_asof(): Both indices must be sorted");
+    _check_asof_policy_<IndexType>(ap, tolerance);
+
+    IndexIdxVector  joined_index_idx;
+    size_type       lo = 0;
+    size_type       hi = 0;
+    auto            same_row = [](size_type i) -> size_type { return (i); };
+
+    joined_index_idx.reserve(lhs_idx_s);
+    for (size_type i = 0; i < lhs_idx_s; ++i)
+        joined_index_idx.emplace_back(
+            i,
+            _asof_match_(lhs_idx[i], rhs_idx, same_row, rhs_idx_s,
+                         lo, hi, ap, tolerance));
+
+    return (index_join_helper_<decltype(*this), RHS_T, Ts ...>
+                (*this, rhs, joined_index_idx));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::
+join_asof(const RHS_T &rhs,
+          const char *by_name,
+          asof_policy ap,
+          double tolerance) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_asof() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    const auto      &lhs_idx = get_index();
+    const auto      &rhs_idx = rhs.get_index();
+    const auto      &lhs_by = get_column<T>(by_name);
+    const auto      &rhs_by = rhs.template get_column<T>(by_name);
+    const size_type lhs_idx_s = lhs_idx.size();
+    const size_type lhs_by_s = std::min(lhs_by.size(), lhs_idx_s);
+    const size_type rhs_by_s = std::min(rhs_by.size(), rhs_idx.size());
+
+    if (! std::is_sorted(lhs_idx.begin(), lhs_idx.end()) ||
+        ! std::is_sorted(rhs_idx.begin(), rhs_idx.end()))
+        throw NotFeasible("join_asof(): Both indices must be sorted");
+    _check_asof_policy_<IndexType>(ap, tolerance);
+
+    // The rhs rows of each by value, in index order, and their position in
+    // the linear pass
+    //
+    struct  ByRows  {
+        StlVecType<size_type>   rows { };
+        size_type               lo { 0 };
+        size_type               hi { 0 };
+    };
+
+    std::unordered_map<T, ByRows>   by_table;
+
+    for (size_type i = 0; i < rhs_by_s; ++i)
+        by_table[rhs_by[i]].rows.push_back(i);
+
+    IndexIdxVector  joined_index_idx;
+
+    joined_index_idx.reserve(lhs_idx_s);
+    for (size_type i = 0; i < lhs_idx_s; ++i)  {
+        const auto  iter =
+            i < lhs_by_s ? by_table.find(lhs_by[i]) : by_table.end();
+
+        if (iter == by_table.end())  {
+            joined_index_idx.emplace_back(
+                i, std::numeric_limits<size_type>::max());
+            continue;
+        }
+
+        ByRows  &by_rows = iter->second;
+        auto    row_at =
+            [&rows = by_rows.rows](size_type j) -> size_type  {
+                return (rows[j]);
+            };
+
+        joined_index_idx.emplace_back(
+            i,
+            _asof_match_(lhs_idx[i], rhs_idx, row_at, by_rows.rows.size(),
+                         by_rows.lo, by_rows.hi, ap, tolerance));
+    }
+
+    DataFrame<IndexType, HeteroVector<align_value>> result;
+
+    result.load_index(lhs_idx.begin(), lhs_idx.end());
+    {
+        const SpinGuard guard(lock_);
+
+        result.template load_column<T>(
+            by_name,
+            StlVecType<T>(lhs_by.begin(), lhs_by.end()),
+            nan_policy::pad_with_nans,
+            false);
+    }
+    join_helper_common_<decltype(*this), RHS_T, IndexType, Ts ...>
+        (*this, rhs, joined_index_idx, result, { by_name });
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T>
+typename DataFrame<I, H>::JoinRowsVec
+DataFrame<I, H>::
+join_by_index_rows(const RHS_T &rhs,
+                   join_policy jp,
+                   join_algorithm ja) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_by_index_rows() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (get_join_index_idx_vector_<IndexType>(get_index(),
+                                                  rhs.get_index(),
+                                                  jp, ja));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T>
+typename DataFrame<I, H>::JoinRowsVec
+DataFrame<I, H>::
+join_by_column_rows(const RHS_T &rhs,
+                    const char *name,
+                    join_policy jp,
+                    join_algorithm ja) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_by_column_rows() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (get_join_index_idx_vector_<T>(get_column<T>(name),
+                                          rhs.template get_column<T>(name),
+                                          jp, ja));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename ... Ts>
+DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, H>::
+gather_join_columns(const RHS_T &rhs,
+                    const JoinRowsVec &join_rows,
+                    const StlVecType<const char *> &lhs_col_names,
+                    const StlVecType<const char *> &rhs_col_names) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to gather_join_columns() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    DataFrame<IndexType, HeteroVector<align_value>> result;
+    StlVecType<IndexType>                           result_index;
+
+    result_index.reserve(join_rows.size());
+    for (const auto &citer : join_rows)  {
+        const size_type left_i = std::get<0>(citer);
+
+        result_index.push_back(
+            left_i != std::numeric_limits<size_type>::max()
+                ? indices_[left_i] : rhs.indices_[std::get<1>(citer)]);
+    }
+    result.load_index(std::move(result_index));
+
+    ColumnJobVector gather_jobs;
+    ColumnJobVector load_jobs;
+    auto            find_col =
+        [](const auto &df, const char *col_name) -> size_type  {
+            const auto  citer = df.column_tb_.find(col_name);
+
+            if (citer == df.column_tb_.end())  {
+                char buffer [512];
+
+                snprintf(buffer, sizeof(buffer) - 1,
+                         "DataFrame::gather_join_columns(): ERROR: "
+                         "Cannot find column '%s'",
+                         col_name);
+                throw ColNotFound(buffer);
+            }
+            return (citer->second);
+        };
+    auto            is_listed =
+        [](const StlVecType<const char *> &col_names,
+           const char *col_name) -> bool  {
+            for (const char *name : col_names)
+                if (! ::strcmp(name, col_name))  return (true);
+            return (false);
+        };
+    const SpinGuard guard(lock_);
+
+    for (const char *col_name : lhs_col_names)  {
+        const size_type col_idx = find_col(*this, col_name);
+
+        if (is_listed(rhs_col_names, col_name))  {
+            find_col(rhs, col_name);
+
+            index_join_functor_common_<decltype(result), Ts ...> functor(
+                col_name,
+                rhs,
+                join_rows,
+                result,
+                gather_jobs,
+                load_jobs);
+
+            data_[col_idx].change(functor);
+        }
+        else  {
+            // 0 = Left
+            index_join_functor_oneside_<0, decltype(result), Ts ...> functor (
+                col_name,
+                join_rows,
+                result,
+                gather_jobs,
+                load_jobs);
+
+            data_[col_idx].change(functor);
+        }
+    }
+    for (const char *col_name : rhs_col_names)  {
+        const size_type col_idx = find_col(rhs, col_name);
+
+        if (! is_listed(lhs_col_names, col_name))  {
+            // 1 = Right
+            index_join_functor_oneside_<1, decltype(result), Ts ...> functor (
+                col_name,
+                join_rows,
+                result,
+                gather_jobs,
+                load_jobs);
+
+            rhs.data_[col_idx].change(functor);
+        }
+    }
+
+    _run_jobs_in_parallel_(gather_jobs, get_thread_level());
+    for (auto &job : load_jobs)  job();
+    return (result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::
+join_by_interval(const RHS_T &rhs,
+                 const char *point_name,
+                 const char *begin_name,
+                 const char *end_name,
+                 join_policy jp) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to join_by_interval() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    if (jp != join_policy::inner_join && jp != join_policy::left_join)
+        throw NotFeasible("join_by_interval(): "
+                          "Only inner_join and left_join are supported");
+
+    const auto      &begins = rhs.template get_column<T>(begin_name);
+    const auto      &ends = rhs.template get_column<T>(end_name);
+    const bool      keep_unmatched = jp == join_policy::left_join;
+    IndexIdxVector  joined_index_idx;
+
+    if (! ::strcmp(point_name, DF_INDEX_COL_NAME))  {
+        if constexpr (std::is_same<T, IndexType>::value)
+            _interval_join_rows_<T>(get_index(), get_index().size(),
+                                    begins, ends,
+                                    keep_unmatched, joined_index_idx);
+        else
+            throw NotFeasible("join_by_interval(): "
+                              "To join on index, T must be IndexType");
+    }
+    else
+        _interval_join_rows_<T>(get_column<T>(point_name), get_index().size(),
+                                begins, ends,
+                                keep_unmatched, joined_index_idx);
+
+    return (index_join_helper_<decltype(*this), RHS_T, Ts ...>
+                (*this, rhs, joined_index_idx));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T>
+typename DataFrame<I, H>::template StlVecType<
+    typename DataFrame<I, H>::size_type>
+DataFrame<I, H>::
+semi_join_rows_(const RHS_T &rhs, const char *name, bool anti) const  {
+
+    StlVecType<size_type>   rows;
+
+    if (! ::strcmp(name, DF_INDEX_COL_NAME))  {
+        if constexpr (std::is_same<T, IndexType>::value)
+            _semi_join_rows_<T>(get_index(), rhs.get_index(), anti, rows);
+        else
+            throw NotFeasible("semi_join_rows_(): "
+                              "To join on index, T must be IndexType");
     }
+    else
+        _semi_join_rows_<T>(get_column<T>(name),
+                            rhs.template get_column<T>(name),
+                            anti,
+                            rows);
+    return (rows);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::semi_join(const RHS_T &rhs, const char *name) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to semi_join() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (data_by_sel_common_<Ts ...>
+                (semi_join_rows_<RHS_T, T>(rhs, name, false)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+typename DataFrame<I, H>::PtrView
+DataFrame<I, H>::semi_join_view(const RHS_T &rhs, const char *name)  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to semi_join_view() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (view_by_sel_common_<PtrView, DataFrame, Ts ...>
+                (*this, semi_join_rows_<RHS_T, T>(rhs, name, false)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+typename DataFrame<I, H>::ConstPtrView
+DataFrame<I, H>::semi_join_view(const RHS_T &rhs, const char *name) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to semi_join_view() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (view_by_sel_common_<ConstPtrView, const DataFrame, Ts ...>
+                (*this, semi_join_rows_<RHS_T, T>(rhs, name, false)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+DataFrame<I, H>
+DataFrame<I, H>::anti_join(const RHS_T &rhs, const char *name) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to anti_join() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (data_by_sel_common_<Ts ...>
+                (semi_join_rows_<RHS_T, T>(rhs, name, true)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+typename DataFrame<I, H>::PtrView
+DataFrame<I, H>::anti_join_view(const RHS_T &rhs, const char *name)  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to anti_join_view() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (view_by_sel_common_<PtrView, DataFrame, Ts ...>
+                (*this, semi_join_rows_<RHS_T, T>(rhs, name, true)));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename RHS_T, typename T, typename ... Ts>
+typename DataFrame<I, H>::ConstPtrView
+DataFrame<I, H>::anti_join_view(const RHS_T &rhs, const char *name) const  {
+
+    static_assert(
+        std::is_base_of<DataFrame<I, HeteroVector<std::size_t(H::align_value)>>,
+                        RHS_T>::value ||
+        std::is_base_of<View, RHS_T>::value ||
+        std::is_base_of<PtrView, RHS_T>::value,
+        "The rhs argument to anti_join_view() can only be "
+        "StdDataFrame<IndexType> or DataFrame[Ptr]View<IndexType>");
+
+    return (view_by_sel_common_<ConstPtrView, const DataFrame, Ts ...>
+                (*this, semi_join_rows_<RHS_T, T>(rhs, name, true)));
 }
 
 // ----------------------------------------------------------------------------
@@ -165,15 +654,23 @@ join_helper_common_(
     const RHS_T &rhs,
     const IndexIdxVector &joined_index_idx,
     DataFrame<IDX_T, HeteroVector<std::size_t(H::align_value)>> &result,
-    const char *skip_col_name)  {
-
+    const StlVecType<const char *> &skip_col_names)  {
+
+    ColumnJobVector gather_jobs;
+    ColumnJobVector load_jobs;
+    auto            is_skipped =
+        [&skip_col_names](const auto &col_name) -> bool  {
+            for (const char *skip_col_name : skip_col_names)
+                if (col_name == skip_col_name)  return (true);
+            return (false);
+        };
     const SpinGuard guard(lock_);
 
     // Load the common and lhs columns
     for (const auto &iter : lhs.column_list_)  {
         auto    rhs_citer = rhs.column_tb_.find(iter.first);
 
-        if (skip_col_name && iter.first == skip_col_name)  continue;
+        if (is_skipped(iter.first))  continue;
 
         // Common column between two frames
         if (rhs_citer != rhs.column_tb_.end())  {
@@ -181,7 +678,9 @@ join_helper_common_(
                 iter.first.c_str(),
                 rhs,
                 joined_index_idx,
-                result);
+                result,
+                gather_jobs,
+                load_jobs);
 
             lhs.data_[iter.second].change(functor);
         }
@@ -190,7 +689,9 @@ join_helper_common_(
             index_join_functor_oneside_<0, decltype(result), Ts ...> functor (
                 iter.first.c_str(),
                 joined_index_idx,
-                result);
+                result,
+                gather_jobs,
+                load_jobs);
 
             lhs.data_[iter.second].change(functor);
         }
@@ -200,18 +701,26 @@ join_helper_common_(
     for (const auto &iter : rhs.column_list_)  {
         auto    lhs_citer = lhs.column_tb_.find(iter.first);
 
-        if (skip_col_name && iter.first == skip_col_name)  continue;
+        if (is_skipped(iter.first))  continue;
 
         if (lhs_citer == lhs.column_tb_.end())  {  // rhs only column
             // 1 = Right
             index_join_functor_oneside_<1, decltype(result), Ts ...> functor (
                 iter.first.c_str(),
                 joined_index_idx,
-                result);
+                result,
+                gather_jobs,
+                load_jobs);
 
             rhs.data_[iter.second].change(functor);
         }
     }
+
+    // The columns are gathered in parallel, but loaded into result one at a
+    // time, in the same order as above
+    //
+    _run_jobs_in_parallel_(gather_jobs, get_thread_level());
+    for (auto &job : load_jobs)  job();
 }
 
 // ----------------------------------------------------------------------------
@@ -245,12 +754,11 @@ index_join_helper_(const LHS_T &lhs,
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
+template<typename LHS_T, typename RHS_T>
 DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
 DataFrame<I, H>::
-column_join_helper_(const LHS_T &lhs,
+column_join_result_(const LHS_T &lhs,
                     const RHS_T &rhs,
-                    const char *col_name,
                     const IndexIdxVector &joined_index_idx)  {
 
     using left_idx_t = typename std::remove_reference<LHS_T>::type::IndexType;
@@ -266,30 +774,19 @@ column_join_helper_(const LHS_T &lhs,
             0, static_cast<unsigned int>(jii_s), 1));
 
     // Load the lhs and rhs indices into two columns in the result
-    // Also load the unified named column
     StlVecType<left_idx_t>  lhs_index;
     StlVecType<right_idx_t> rhs_index;
-    StlVecType<T>           named_col_vec;
-    const ColumnVecType<T>  &lhs_named_col_vec =
-        lhs.template get_column<T>(col_name);
-    const ColumnVecType<T>  &rhs_named_col_vec =
-        rhs.template get_column<T>(col_name);
 
     lhs_index.reserve(jii_s);
     rhs_index.reserve(jii_s);
-    named_col_vec.reserve(jii_s);
     for (auto citer : joined_index_idx)  {
         const size_type left_i = std::get<0>(citer);
         const size_type right_i = std::get<1>(citer);
 
-        if (left_i != std::numeric_limits<size_type>::max())  {
+        if (left_i != std::numeric_limits<size_type>::max())
             lhs_index.push_back(lhs.indices_[left_i]);
-            named_col_vec.push_back(lhs_named_col_vec[left_i]);
-        }
-        else  {
-            named_col_vec.push_back(rhs_named_col_vec[right_i]);
+        else
             lhs_index.push_back(get_nan<left_idx_t>());
-        }
         if (right_i != std::numeric_limits<size_type>::max())
             rhs_index.push_back(rhs.indices_[right_i]);
         else
@@ -310,25 +807,245 @@ column_join_helper_(const LHS_T &lhs,
                                                  std::move(rhs_index),
                                                  nan_policy::pad_with_nans,
                                                  false);
-        result.template load_column<T>(col_name,
-                                       std::move(named_col_vec),
-                                       nan_policy::pad_with_nans,
-                                       false);
     }
+    return(result);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename LHS_T, typename RHS_T, typename T>
+void DataFrame<I, H>::
+join_key_column_(
+    const LHS_T &lhs,
+    const RHS_T &rhs,
+    const char *col_name,
+    const IndexIdxVector &joined_index_idx,
+    DataFrame<unsigned int,
+              HeteroVector<std::size_t(H::align_value)>> &result)  {
+
+    // Load the unified named column
+    StlVecType<T>   named_col_vec;
+    const auto      &lhs_named_col_vec = lhs.template get_column<T>(col_name);
+    const auto      &rhs_named_col_vec = rhs.template get_column<T>(col_name);
+
+    named_col_vec.reserve(joined_index_idx.size());
+    for (auto citer : joined_index_idx)  {
+        const size_type left_i = std::get<0>(citer);
+
+        if (left_i != std::numeric_limits<size_type>::max())
+            named_col_vec.push_back(lhs_named_col_vec[left_i]);
+        else
+            named_col_vec.push_back(rhs_named_col_vec[std::get<1>(citer)]);
+    }
+
+    const SpinGuard guard(lock_);
+
+    result.template load_column<T>(col_name,
+                                   std::move(named_col_vec),
+                                   nan_policy::pad_with_nans,
+                                   false);
+}
+
+// ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
+DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
+DataFrame<I, H>::
+column_join_helper_(const LHS_T &lhs,
+                    const RHS_T &rhs,
+                    const char *col_name,
+                    const IndexIdxVector &joined_index_idx)  {
+
+    auto    result = column_join_result_(lhs, rhs, joined_index_idx);
+
+    join_key_column_<LHS_T, RHS_T, T>
+        (lhs, rhs, col_name, joined_index_idx, result);
     join_helper_common_<LHS_T, RHS_T, unsigned int, Ts ...>
-        (lhs, rhs, joined_index_idx, result, col_name);
+        (lhs, rhs, joined_index_idx, result, { col_name });
     return(result);
 }
 
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename T>
+template<typename LHS_V, typename RHS_V>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_sorted_index_idx_vector_(const LHS_V &lhs_vec,
+                                              const RHS_V &rhs_vec,
+                                              join_policy jp)  {
+
+    return (get_merge_index_idx_vector_(SortedJoinView_<LHS_V>(lhs_vec),
+                                        SortedJoinView_<RHS_V>(rhs_vec),
+                                        jp));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename LHS_V, typename RHS_V>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_merge_index_idx_vector_(const LHS_V &lhs_view,
+                                             const RHS_V &rhs_view,
+                                             join_policy jp)  {
+
+    switch(jp)  {
+        case join_policy::inner_join:
+            return (get_inner_index_idx_vector_(lhs_view, rhs_view));
+        case join_policy::left_join:
+            return (get_left_index_idx_vector_(lhs_view, rhs_view));
+        case join_policy::right_join:
+            return (get_right_index_idx_vector_(lhs_view, rhs_view));
+        case join_policy::left_right_join:
+        default:
+            return (get_left_right_index_idx_vector_(lhs_view, rhs_view));
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename HASH, typename LHS_V, typename RHS_V>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_hash_index_idx_vector_(const LHS_V &lhs_vec,
+                                            const RHS_V &rhs_vec,
+                                            join_policy jp)  {
+
+    if constexpr (! std::is_default_constructible<HASH>::value)  {
+        throw NotFeasible("get_hash_index_idx_vector_(): "
+                          "Hash join needs a key type hashable by std::hash");
+    }
+    else  {
+        constexpr size_type     npos = std::numeric_limits<size_type>::max();
+        const size_type         lhs_s = lhs_vec.size();
+        const size_type         rhs_s = rhs_vec.size();
+        StlVecType<size_type>   lhs_match (lhs_s, npos);
+        StlVecType<size_type>   rhs_match (rhs_s, npos);
+
+        // Build on the smaller side and probe with the larger side
+        //
+        if (lhs_s <= rhs_s)
+            _hash_join_match_<T, HASH>(lhs_vec, rhs_vec,
+                                       lhs_match, rhs_match,
+                                       get_thread_level());
+        else
+            _hash_join_match_<T, HASH>(rhs_vec, lhs_vec,
+                                       rhs_match, lhs_match,
+                                       get_thread_level());
+
+        IndexIdxVector  joined_index_idx;
+
+        if (jp == join_policy::right_join)  {
+            joined_index_idx.reserve(rhs_s);
+            for (size_type i = 0; i < rhs_s; ++i)
+                joined_index_idx.emplace_back(rhs_match[i], i);
+        }
+        else  {
+            joined_index_idx.reserve(
+                jp == join_policy::inner_join ? std::min(lhs_s, rhs_s)
+                                              : lhs_s);
+            for (size_type i = 0; i < lhs_s; ++i)
+                if (jp != join_policy::inner_join || lhs_match[i] != npos)
+                    joined_index_idx.emplace_back(i, lhs_match[i]);
+            if (jp == join_policy::left_right_join)
+                for (size_type i = 0; i < rhs_s; ++i)
+                    if (rhs_match[i] == npos)
+                        joined_index_idx.emplace_back(npos, i);
+        }
+        return (joined_index_idx);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename LHS_V, typename RHS_V>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::
+get_join_index_idx_vector_(const LHS_V &lhs_vec,
+                           const RHS_V &rhs_vec,
+                           join_policy jp,
+                           join_algorithm ja)  {
+
+    if (ja == join_algorithm::hash)
+        return (get_hash_index_idx_vector_<T>(lhs_vec, rhs_vec, jp));
+
+    // Time indices are most often sorted already. Then they can be merged
+    // in place without copying or sorting them.
+    //
+    if (std::is_sorted(lhs_vec.begin(), lhs_vec.end()) &&
+        std::is_sorted(rhs_vec.begin(), rhs_vec.end()))
+        return (get_sorted_index_idx_vector_(lhs_vec, rhs_vec, jp));
+
+    const size_type                 lhs_vec_s = lhs_vec.size();
+    const size_type                 rhs_vec_s = rhs_vec.size();
+    StlVecType<JoinSortingPair<T>>  col_vec_lhs;
+    StlVecType<JoinSortingPair<T>>  col_vec_rhs;
+
+    col_vec_lhs.reserve(lhs_vec_s);
+    for (size_type i = 0; i < lhs_vec_s; ++i)
+        col_vec_lhs.push_back(std::make_pair(&(lhs_vec[i]), i));
+    col_vec_rhs.reserve(rhs_vec_s);
+    for (size_type i = 0; i < rhs_vec_s; ++i)
+        col_vec_rhs.push_back(std::make_pair(&(rhs_vec[i]), i));
+
+    auto    cf = [] (const JoinSortingPair<T> &l,
+                     const JoinSortingPair<T> &r) -> bool  {
+                     return (*(l.first) < *(r.first));
+                 };
+
+    std::sort(col_vec_lhs.begin(), col_vec_lhs.end(), cf);
+    std::sort(col_vec_rhs.begin(), col_vec_rhs.end(), cf);
+    return (get_merge_index_idx_vector_(col_vec_lhs, col_vec_rhs, jp));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename LHS_K, typename RHS_K>
 typename DataFrame<I, H>::IndexIdxVector
-DataFrame<I, H>::get_inner_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
+DataFrame<I, H>::get_multi_key_index_idx_vector_(const LHS_K &lhs_keys,
+                                                 const RHS_K &rhs_keys,
+                                                 join_policy jp,
+                                                 join_algorithm ja)  {
+
+    if (ja == join_algorithm::hash)
+        return (get_hash_index_idx_vector_<typename LHS_K::value_type,
+                                           TupleHash>
+                    (lhs_keys, rhs_keys, jp));
+
+    // Sort the row numbers by their keys, unless they are sorted already
+    //
+    auto    sorted_rows =
+        [](const auto &keys) -> StlVecType<size_type>  {
+            StlVecType<size_type>   rows (keys.size());
+            auto                    cf =
+                [&keys](size_type lhs, size_type rhs) -> bool  {
+                    return (keys[lhs] < keys[rhs]);
+                };
+
+            std::iota(rows.begin(), rows.end(), 0);
+            if (! std::is_sorted(rows.begin(), rows.end(), cf))
+                std::sort(rows.begin(), rows.end(), cf);
+            return (rows);
+        };
+    const StlVecType<size_type> lhs_rows = sorted_rows(lhs_keys);
+    const StlVecType<size_type> rhs_rows = sorted_rows(rhs_keys);
+
+    return (get_merge_index_idx_vector_(
+                RowsJoinView_<LHS_K>(lhs_keys, lhs_rows),
+                RowsJoinView_<RHS_K>(rhs_keys, rhs_rows),
+                jp));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename LHS_V, typename RHS_V>
+typename DataFrame<I, H>::IndexIdxVector
+DataFrame<I, H>::get_inner_index_idx_vector_(const LHS_V &col_vec_lhs,
+                                             const RHS_V &col_vec_rhs)  {
 
     size_type       lhs_current = 0;
     const size_type lhs_end = col_vec_lhs.size();
@@ -356,43 +1073,10 @@ DataFrame<I, H>::get_inner_index_idx_vector_(
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_inner_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-        (lhs, rhs,
-         get_inner_index_idx_vector_<IndexType>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_inner_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_inner_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 typename DataFrame<I, H>::IndexIdxVector
-DataFrame<I, H>::get_left_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
+DataFrame<I, H>::get_left_index_idx_vector_(const LHS_V &col_vec_lhs,
+                                            const RHS_V &col_vec_rhs)  {
 
     size_type       lhs_current = 0;
     const size_type lhs_end = col_vec_lhs.size();
@@ -428,43 +1112,10 @@ DataFrame<I, H>::get_left_index_idx_vector_(
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_left_join_(const LHS_T &lhs, const RHS_T &rhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                 const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_left_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                       col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_left_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const char *col_name,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_left_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 typename DataFrame<I, H>::IndexIdxVector
-DataFrame<I, H>::get_right_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
+DataFrame<I, H>::get_right_index_idx_vector_(const LHS_V &col_vec_lhs,
+                                             const RHS_V &col_vec_rhs)  {
 
     size_type       lhs_current = 0;
     const size_type lhs_end = col_vec_lhs.size();
@@ -504,43 +1155,10 @@ DataFrame<I, H>::get_right_index_idx_vector_(
 // ----------------------------------------------------------------------------
 
 template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_right_join_(const LHS_T &lhs, const RHS_T &rhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_right_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                        col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_right_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_right_index_idx_vector_<T>(col_vec_lhs, col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 typename DataFrame<I, H>::IndexIdxVector
-DataFrame<I, H>::get_left_right_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
+DataFrame<I, H>::get_left_right_index_idx_vector_(const LHS_V &col_vec_lhs,
+                                                  const RHS_V &col_vec_rhs)  {
 
     size_type       lhs_current = 0;
     const size_type lhs_end = col_vec_lhs.size();
@@ -586,41 +1204,6 @@ DataFrame<I, H>::get_left_right_index_idx_vector_(
 
 // ----------------------------------------------------------------------------
 
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-DataFrame<I, HeteroVector<std::size_t(H::align_value)>> DataFrame<I, H>::
-index_left_right_join_(
-    const LHS_T &lhs,
-    const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs) {
-
-    return (index_join_helper_<LHS_T, RHS_T, Ts ...>
-                (lhs, rhs,
-                 get_left_right_index_idx_vector_<IndexType>(col_vec_lhs,
-                                                             col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
-template<typename I, typename H>
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-DataFrame<I, H>::
-column_left_right_join_(const LHS_T &lhs,
-                        const RHS_T &rhs,
-                        const char *col_name,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                        const StlVecType<JoinSortingPair<T>> &col_vec_rhs)  {
-
-    return (column_join_helper_<LHS_T, RHS_T, T, Ts ...>
-                (lhs, rhs, col_name,
-                 get_left_right_index_idx_vector_<T>(col_vec_lhs,
-                                                     col_vec_rhs)));
-}
-
-// ----------------------------------------------------------------------------
-
 template<typename I, typename H>
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 void DataFrame<I, H>::
@@ -687,6 +1270,7 @@ DataFrame<I, H>::self_concat(const RHS_T &rhs, bool add_new_columns)  {
     const SpinGuard guard(lock_);
 
     concat_helper_<decltype(*this), RHS_T, Ts ...>(*this, rhs, add_new_columns);
+    touch_column(nullptr);
 }
 
 // ----------------------------------------------------------------------------
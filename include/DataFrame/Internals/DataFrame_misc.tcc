@@ -32,6 +32,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <random>
 
 // ----------------------------------------------------------------------------
@@ -373,38 +374,49 @@ index_join_functor_common_<RES_T, Ts ...>::operator()(const T &lhs_vec)  {
 
     using VecType = typename std::remove_reference<T>::type;
     using ValueType = typename VecType::value_type;
+    using ColPair = std::pair<StlVecType<ValueType>, StlVecType<ValueType>>;
 
     const ColumnVecType<ValueType>  &rhs_vec = rhs.get_column<ValueType>(name);
-    StlVecType<ValueType>           lhs_result_col;
-    StlVecType<ValueType>           rhs_result_col;
-
-    lhs_result_col.reserve(joined_index_idx.size());
-    rhs_result_col.reserve(joined_index_idx.size());
-    for (const auto &citer : joined_index_idx)  {
-        const size_type left_i = std::get<0>(citer);
-        const size_type right_i = std::get<1>(citer);
-
-        lhs_result_col.push_back(
-            left_i != std::numeric_limits<size_type>::max()
-                ? lhs_vec[left_i] : get_nan<ValueType>());
-        rhs_result_col.push_back(
-            right_i != std::numeric_limits<size_type>::max()
-                ? rhs_vec[right_i] : get_nan<ValueType>());
-    }
-
-    char    lhs_str[256];
-    char    rhs_str[256];
-
-    ::snprintf(lhs_str, sizeof(lhs_str) - 1, "lhs.%s", name);
-    ::snprintf(rhs_str, sizeof(rhs_str) - 1, "rhs.%s", name);
-    result.template load_column<ValueType>(lhs_str,
-                                           std::move(lhs_result_col),
-                                           nan_policy::pad_with_nans,
-                                           false);
-    result.template load_column<ValueType>(rhs_str,
-                                           std::move(rhs_result_col),
-                                           nan_policy::pad_with_nans,
-                                           false);
+    const auto                      result_cols = std::make_shared<ColPair>();
+
+    gather_jobs.push_back(
+        [&lhs_vec, &rhs_vec, result_cols,
+         &joined_index_idx = joined_index_idx]() -> void  {
+            auto    &lhs_result_col = result_cols->first;
+            auto    &rhs_result_col = result_cols->second;
+
+            lhs_result_col.reserve(joined_index_idx.size());
+            rhs_result_col.reserve(joined_index_idx.size());
+            for (const auto &citer : joined_index_idx)  {
+                const size_type left_i = std::get<0>(citer);
+                const size_type right_i = std::get<1>(citer);
+
+                lhs_result_col.push_back(
+                    left_i != std::numeric_limits<size_type>::max()
+                        ? lhs_vec[left_i] : get_nan<ValueType>());
+                rhs_result_col.push_back(
+                    right_i != std::numeric_limits<size_type>::max()
+                        ? rhs_vec[right_i] : get_nan<ValueType>());
+            }
+        });
+    load_jobs.push_back(
+        [result_cols, &result = result, name = name]() -> void  {
+            char    lhs_str[256];
+            char    rhs_str[256];
+
+            ::snprintf(lhs_str, sizeof(lhs_str) - 1, "lhs.%s", name);
+            ::snprintf(rhs_str, sizeof(rhs_str) - 1, "rhs.%s", name);
+            result.template load_column<ValueType>(
+                lhs_str,
+                std::move(result_cols->first),
+                nan_policy::pad_with_nans,
+                false);
+            result.template load_column<ValueType>(
+                rhs_str,
+                std::move(result_cols->second),
+                nan_policy::pad_with_nans,
+                false);
+        });
 }
 
 // ----------------------------------------------------------------------------
@@ -418,21 +430,26 @@ operator()(const T &vec)  {
     using VecType = typename std::remove_reference<T>::type;
     using ValueType = typename VecType::value_type;
 
-    StlVecType<ValueType>   result_col;
-
-    result_col.reserve(joined_index_idx.size());
-    for (const auto &citer : joined_index_idx)  {
-        const size_type i = std::get<SIDE>(citer);
+    const auto  result_col = std::make_shared<StlVecType<ValueType>>();
 
-        result_col.push_back(
-            i != std::numeric_limits<size_type>::max()
-                ? vec[i] : get_nan<ValueType>());
-    }
+    gather_jobs.push_back(
+        [&vec, result_col, &joined_index_idx = joined_index_idx]() -> void  {
+            result_col->reserve(joined_index_idx.size());
+            for (const auto &citer : joined_index_idx)  {
+                const size_type i = std::get<SIDE>(citer);
 
-    result.template load_column<ValueType>(name,
-                                           std::move(result_col),
-                                           nan_policy::pad_with_nans,
-                                           false);
+                result_col->push_back(
+                    i != std::numeric_limits<size_type>::max()
+                        ? vec[i] : get_nan<ValueType>());
+            }
+        });
+    load_jobs.push_back(
+        [result_col, &result = result, name = name]() -> void  {
+            result.template load_column<ValueType>(name,
+                                                   std::move(*result_col),
+                                                   nan_policy::pad_with_nans,
+                                                   false);
+        });
 }
 
 // ----------------------------------------------------------------------------
@@ -637,6 +654,47 @@ operator() (const T &vec)  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename IT, typename DF, typename ... Ts>
+template<typename T>
+void
+DataFrame<I, H>::
+sel_gather_functor_<IT, DF, Ts ...>::
+operator() (const T &vec)  {
+
+    using VecType = typename std::remove_reference<T>::type;
+    using ValueType = typename VecType::value_type;
+
+    auto    new_col = std::make_shared<StlVecType<ValueType>>();
+
+    gather_jobs.push_back(
+        [&vec, new_col,
+         &sel_indices = sel_indices,
+         indices_size = indices_size]() -> void  {
+            const size_type vec_size = vec.size();
+
+            new_col->reserve(std::min(sel_indices.size(), vec_size));
+            for (auto citer : sel_indices)  {
+                const size_type index =
+                    citer >= 0 ? citer : static_cast<IT>(indices_size) + citer;
+
+                if (index < vec_size)
+                    new_col->push_back(vec[index]);
+                else
+                    break;
+            }
+        });
+    load_jobs.push_back([new_col, name = name, &df = df]() -> void  {
+        df.template load_column<ValueType>(name,
+                                           std::move(*new_col),
+                                           nan_policy::dont_pad_with_nans,
+                                           false);
+    });
+    return;
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename IT, typename DF, typename ... Ts>
 template<typename T>
@@ -719,15 +777,12 @@ DataFrame<I, H>::
 sel_remove_functor_<Ts ...>::
 operator() (T &vec) const  {
 
-    const size_type sel_indices_s = sel_indices.size();
-    const size_type vec_s = vec.size();
-    size_type       del_count = 0;
-
-    for (size_type i = 0; i < sel_indices_s; ++i)
-        if (sel_indices[i] < vec_s)
-            vec.erase(vec.begin() + (sel_indices[i] - del_count++));
-        else
-            break;
+    if (jobs)
+        jobs->push_back([&vec, &sel_indices = sel_indices]() -> void  {
+            _remove_sorted_rows_(vec, sel_indices);
+        });
+    else
+        _remove_sorted_rows_(vec, sel_indices);
     return;
 }
 
@@ -891,71 +946,21 @@ template<typename T>
 void
 DataFrame<I, H>::describe_functor_<Ts ...>::operator() (const T &vec)  {
 
-    const size_type vec_s = vec.size();
-
-    if (vec_s < 3)  return;
-
-    using VecType = typename std::remove_reference<T>::type;
-    using ValueType = typename VecType::value_type;
-
-    StlVecType<double>  col_to_load;
-
-    col_to_load.reserve(describe_index_col.size());
-    col_to_load.push_back(double(vec_s));
-
-    size_type   missing_cnt =  0;
-    ValueType   minv = vec[0];
-    ValueType   maxv = vec[0];
-    ValueType   sum = vec[0];
-
-    if (is_nan<ValueType>(vec[0]))  missing_cnt += 1;
-    for (size_type i = 1; i < vec_s; ++i)  {
-        if (is_nan<ValueType>(vec[i]))
-            missing_cnt += 1;
-        else  {
-            if (vec[i] > maxv)  maxv = vec[i];
-            if (vec[i] < minv)  minv = vec[i];
-            sum += vec[i];
-        }
-    }
-    col_to_load.push_back(double(missing_cnt));
-    col_to_load.push_back(sum  / double(vec_s - missing_cnt));
-
-    StdVisitor<ValueType, ValueType>    stdev;
-
-    stdev.pre();
-    stdev(vec.begin(), vec.end(), vec.begin(), vec.end());
-    stdev.post();
-
-    col_to_load.push_back(double(stdev.get_result()));
-    col_to_load.push_back(double(minv));
-    col_to_load.push_back(double(maxv));
-
-    QuantileVisitor<ValueType, ValueType>   qt25(0.25);
-
-    qt25.pre();
-    qt25(vec.begin(), vec.end(), vec.begin(), vec.end());
-    qt25.post();
-    col_to_load.push_back(double(qt25.get_result()));
-
-    QuantileVisitor<ValueType, ValueType>   qt50(0.5);
-
-    qt50.pre();
-    qt50(vec.begin(), vec.end(), vec.begin(), vec.end());
-    qt50.post();
-    col_to_load.push_back(double(qt50.get_result()));
-
-    QuantileVisitor<ValueType, ValueType>   qt75(0.75);
-
-    qt75.pre();
-    qt75(vec.begin(), vec.end(), vec.begin(), vec.end());
-    qt75.post();
-    col_to_load.push_back(double(qt75.get_result()));
-
-    result.template load_column<double>(name,
-                                        std::move(col_to_load),
-                                        nan_policy::pad_with_nans,
-                                        false);
+    if (vec.size() < 3)  return;
+
+    auto    col_to_load = std::make_shared<StlVecType<double>>();
+
+    col_to_load->reserve(describe_index_col.size());
+    stats_jobs.push_back([&vec, col_to_load]() -> void  {
+        _describe_col_(vec, *col_to_load);
+    });
+    load_jobs.push_back(
+        [col_to_load, name = name, &result = result]() -> void  {
+            result.template load_column<double>(name,
+                                                std::move(*col_to_load),
+                                                nan_policy::pad_with_nans,
+                                                false);
+        });
 }
 
 } // namespace hmdf
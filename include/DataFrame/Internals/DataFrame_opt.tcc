@@ -97,6 +97,7 @@ modify_by_idx (DataFrame &rhs, sort_state already_sorted)  {
         }
         else if (indices_[lhs_i] < rhs.indices_[rhs_i])  break;
     }
+    touch_column(nullptr);
 
     return (*this);
 }
@@ -49,6 +49,23 @@ template<typename T>
 size_type
 append_row_(std::pair<const char *, T> &row_name_data);
 
+template<typename T>
+void bind_appender_column_(const char *name);
+
+template<typename ... Ts, std::size_t ... Is>
+Appender<Ts ...>
+get_appender_(const std::array<const char *, sizeof...(Ts)> &col_names,
+              size_type block_size,
+              std::index_sequence<Is ...>);
+
+void appended_(const char *name);
+void refeed_subscriptions_(const char *name);
+
+template<typename V>
+void subscribe_(V &visitor,
+                std::vector<std::string> &&col_names,
+                std::function<size_type(DataFrame &, size_type)> &&feed);
+
 void read_json_(std::istream &file, bool columns_only);
 void read_csv_(std::istream &file, bool columns_only);
 void read_csv2_(std::istream &file,
@@ -60,6 +77,15 @@ template<typename CF, typename ... Ts>
 static void
 sort_common_(DataFrame<I, H> &df, CF &&comp_func, bool ignore_index);
 
+template<typename I_V, typename ... Ts>
+void
+groupby_common_(DataFrame &res,
+                I_V idx_visitor,
+                const StlVecType<size_type> &sort_v,
+                const StlVecType<size_type> &ends,
+                std::tuple<Ts ...> &args,
+                SpinGuard &guard) const;
+
 template<typename T>
 static void
 fill_missing_value_(ColumnVecType<T> &vec,
@@ -125,7 +151,7 @@ template<typename T, typename ITR>
 void
 setup_view_column_(const char *name, Index2D<ITR> range);
 
-using IndexIdxVector = StlVecType<std::tuple<size_type, size_type>>;
+using IndexIdxVector = JoinRowsVec;
 template<typename T>
 using JoinSortingPair = std::pair<const T *, size_type>;
 
@@ -137,7 +163,7 @@ join_helper_common_(const LHS_T &lhs,
                     DataFrame<
                         IDX_T,
                         HeteroVector<std::size_t(H::align_value)>> &result,
-                    const char *skip_col_name = nullptr);
+                    const StlVecType<const char *> &skip_col_names = { });
 
 template<typename LHS_T, typename RHS_T, typename ... Ts>
 static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
@@ -145,6 +171,22 @@ index_join_helper_(const LHS_T &lhs,
                    const RHS_T &rhs,
                    const IndexIdxVector &joined_index_idx);
 
+template<typename LHS_T, typename RHS_T>
+static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
+column_join_result_(const LHS_T &lhs,
+                    const RHS_T &rhs,
+                    const IndexIdxVector &joined_index_idx);
+
+template<typename LHS_T, typename RHS_T, typename T>
+static void
+join_key_column_(const LHS_T &lhs,
+                 const RHS_T &rhs,
+                 const char *col_name,
+                 const IndexIdxVector &joined_index_idx,
+                 DataFrame<
+                     unsigned int,
+                     HeteroVector<std::size_t(H::align_value)>> &result);
+
 template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
 static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
 column_join_helper_(const LHS_T &lhs,
@@ -152,68 +194,141 @@ column_join_helper_(const LHS_T &lhs,
                     const char *col_name,
                     const IndexIdxVector &joined_index_idx);
 
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 static IndexIdxVector
-get_inner_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+get_sorted_index_idx_vector_(const LHS_V &lhs_vec,
+                             const RHS_V &rhs_vec,
+                             join_policy jp);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_inner_join_(
-    const LHS_T &lhs, const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
+template<typename LHS_V, typename RHS_V>
+static IndexIdxVector
+get_merge_index_idx_vector_(const LHS_V &lhs_view,
+                            const RHS_V &rhs_view,
+                            join_policy jp);
 
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_inner_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+template<typename T, typename HASH = std::hash<T>,
+         typename LHS_V, typename RHS_V>
+static IndexIdxVector
+get_hash_index_idx_vector_(const LHS_V &lhs_vec,
+                           const RHS_V &rhs_vec,
+                           join_policy jp);
 
-template<typename T>
+template<typename T, typename LHS_V, typename RHS_V>
 static IndexIdxVector
-get_left_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+get_join_index_idx_vector_(const LHS_V &lhs_vec,
+                           const RHS_V &rhs_vec,
+                           join_policy jp,
+                           join_algorithm ja);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_left_join_(
-    const LHS_T &lhs, const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
+template<typename LHS_K, typename RHS_K>
+static IndexIdxVector
+get_multi_key_index_idx_vector_(const LHS_K &lhs_keys,
+                                const RHS_K &rhs_keys,
+                                join_policy jp,
+                                join_algorithm ja);
 
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_left_join_(const LHS_T &lhs,
-                  const RHS_T &rhs,
-                  const char *col_name,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                  const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+template<typename LHS_V, typename RHS_V>
+static IndexIdxVector
+get_inner_index_idx_vector_(const LHS_V &col_vec_lhs,
+                            const RHS_V &col_vec_rhs);
 
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 static IndexIdxVector
-get_right_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+get_left_index_idx_vector_(const LHS_V &col_vec_lhs,
+                           const RHS_V &col_vec_rhs);
 
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_right_join_(
-    const LHS_T &lhs, const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
+template<typename LHS_V, typename RHS_V>
+static IndexIdxVector
+get_right_index_idx_vector_(const LHS_V &col_vec_lhs,
+                            const RHS_V &col_vec_rhs);
 
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_right_join_(const LHS_T &lhs,
-                   const RHS_T &rhs,
-                   const char *col_name,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-                   const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+template<typename RHS_T, typename T>
+StlVecType<size_type>
+semi_join_rows_(const RHS_T &rhs, const char *name, bool anti) const;
+
+// Only a sel_functor wrapped in concurrent_sel() is run on threads
+//
+template<typename F>
+static size_type
+sel_thread_level_()  {
+
+    return (is_concurrent_sel<F>::value ? get_thread_level() : 0);
+}
+
+template<typename ... Ts>
+DataFrame
+data_by_sel_common_(const StlVecType<size_type> &col_indices) const;
+
+// Same as above, but only the named columns. An empty list means all columns
+//
+template<typename DF, typename ... Ts>
+DF
+data_by_sel_cols_(const StlVecType<size_type> &col_indices,
+                  const StlVecType<const char *> &col_names) const;
+
+// One bit per row, 64 rows to a word.
+// sel_bitmap_() sets the rows a predicate is true for in bits and the rows
+// it is false for in not_bits. A row past the end of a column is in
+// neither.
+//
+using SelBitmap = StlVecType<std::uint64_t>;
+
+template<typename T, typename F>
+void
+sel_col_bitmap_(const char *col_name,
+                const F &test,
+                SelBitmap &bits,
+                SelBitmap &not_bits) const;
+
+template<typename T>
+void
+sel_bitmap_(const SelCompare<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename T>
+void
+sel_bitmap_(const SelRange<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename T>
+void
+sel_bitmap_(const SelIn<T> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename T, typename F>
+void
+sel_bitmap_(const SelFunctor<T, F> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename L, typename R>
+void
+sel_bitmap_(const SelAnd<L, R> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename L, typename R>
+void
+sel_bitmap_(const SelOr<L, R> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename P>
+void
+sel_bitmap_(const SelNot<P> &pred,
+            SelBitmap &bits,
+            SelBitmap &not_bits) const;
+
+template<typename P>
+SelBitmap
+pred_bitmap_(const P &pred) const;
+
+template<typename V, typename DF, typename ... Ts>
+static V
+view_by_sel_common_(DF &df, const StlVecType<size_type> &col_indices);
 
 template<typename MAP, typename ... Ts>
 static DataFrame
@@ -226,27 +341,10 @@ template<typename LHS_T, typename RHS_T, typename ... Ts>
 static void
 concat_helper_(LHS_T &lhs, const RHS_T &rhs, bool add_new_columns);
 
-template<typename T>
+template<typename LHS_V, typename RHS_V>
 static IndexIdxVector
-get_left_right_index_idx_vector_(
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename ... Ts>
-static DataFrame<I, HeteroVector<std::size_t(H::align_value)>>
-index_left_right_join_(
-    const LHS_T &lhs, const RHS_T &rhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<IndexType>> &col_vec_rhs);
-
-template<typename LHS_T, typename RHS_T, typename T, typename ... Ts>
-static DataFrame<unsigned int, HeteroVector<std::size_t(H::align_value)>>
-column_left_right_join_(
-    const LHS_T &lhs,
-    const RHS_T &rhs,
-    const char *col_name,
-    const StlVecType<JoinSortingPair<T>> &col_vec_lhs,
-    const StlVecType<JoinSortingPair<T>> &col_vec_rhs);
+get_left_right_index_idx_vector_(const LHS_V &col_vec_lhs,
+                                 const RHS_V &col_vec_rhs);
 
 // ----------------------------------------------------------------------------
 
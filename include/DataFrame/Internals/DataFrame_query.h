@@ -0,0 +1,136 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+// ----------------------------------------------------------------------------
+
+// This file was factored out so DataFrame.h doesn't become a huge file.
+// This was meant to be included inside the public section of DataFrame class.
+// This file, by itself, is not useable/compile-able.
+
+// ----------------------------------------------------------------------------
+
+// A lazy query over a DataFrame or a view (See DataFrame::query()).
+// where(), select(), and groupby() only record the steps. Nothing is read or
+// copied until collect(), count(), or visit() is called. Then:
+//   1) All where() predicates are evaluated into row bitmaps (in parallel, if
+//      thread level is set) and ANDed together.
+//   2) Only the columns that are selected or needed by groupby() are
+//      gathered at the selected rows, in parallel.
+//   3) The groupby() steps run, in order, on that narrow result.
+// So a query that touches 3 of 60 columns only ever copies 3 columns once.
+//
+// The query holds a reference to the DataFrame. The DataFrame must outlive
+// the query and must not change between recording and collect(). Column
+// names are held as given, so they must also outlive the query.
+//
+class   Query  {
+
+public:
+
+    // collect() always returns a StdDataFrame, even for a view
+    //
+    using Result = DataFrame<I, HeteroVector<align_value>>;
+
+    explicit Query(const DataFrame &df);
+
+    // It records a predicate built from sel_col() (See get_data_by_pred()).
+    // A row is selected if it satisfies all the recorded predicates.
+    //
+    template<typename P>
+    Query &
+    where(const P &pred);
+
+    // It records the columns to keep. It can be called more than once.
+    // If neither select() nor groupby() is called, all columns are kept.
+    //
+    Query &
+    select(const StlVecType<const char *> &col_names);
+
+    // It records a groupby1() step (See groupby1() for the parameters).
+    // The first groupby() also decides which columns are gathered: its
+    // column and the first member of each triple. Later groupby() steps run
+    // on the result of the previous one.
+    //
+    template<typename T, typename I_V, typename ... Ts>
+    Query &
+    groupby(const char *col_name, I_V &&idx_visitor, Ts&& ... args);
+
+    // It runs the recorded steps and returns the result.
+    //
+    // Ts:
+    //   List all the types of all data columns. A type should be specified in
+    //   the list only once.
+    //
+    template<typename ... Ts>
+    [[nodiscard]] Result
+    collect() const;
+
+    // It returns the number of rows that satisfy the recorded predicates.
+    // No column other than the predicate columns is read.
+    //
+    [[nodiscard]] size_type
+    count() const;
+
+    // It runs the visitor over the selected rows of the named column, in
+    // place. Nothing is copied. It throws NotFeasible if a groupby() step
+    // was recorded, use collect() for that.
+    //
+    template<typename T, typename V>
+    V &
+    visit(const char *name, V &visitor) const;
+
+private:
+
+    using Bitmap = StlVecType<std::uint64_t>;
+    using Filter = std::function<void(Bitmap &)>;
+    using Stage = std::function<Result(const Result &)>;
+    using RowVec = StlVecType<size_type>;
+
+    Bitmap
+    bitmap_() const;
+
+    RowVec
+    rows_() const;
+
+    const DataFrame             &df_;
+    StlVecType<Filter>          filters_ { };
+    StlVecType<const char *>    col_names_ { };
+    StlVecType<const char *>    group_col_names_ { };
+    StlVecType<Stage>           stages_ { };
+};
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,237 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <DataFrame/DataFrame.h>
+
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <tuple>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+template<typename I, typename H>
+typename DataFrame<I, H>::Query DataFrame<I, H>::query() const  {
+
+    return (Query(*this));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+DataFrame<I, H>::Query::Query(const DataFrame &df) : df_(df)  {   }
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename P>
+typename DataFrame<I, H>::Query &
+DataFrame<I, H>::Query::where(const P &pred)  {
+
+    filters_.push_back([&df = df_, pred](Bitmap &bits) -> void  {
+        bits = df.pred_bitmap_(pred);
+    });
+    return (*this);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::Query &
+DataFrame<I, H>::Query::select(const StlVecType<const char *> &col_names)  {
+
+    col_names_.insert(col_names_.end(), col_names.begin(), col_names.end());
+    return (*this);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename I_V, typename ... Ts>
+typename DataFrame<I, H>::Query &
+DataFrame<I, H>::Query::
+groupby(const char *col_name, I_V &&idx_visitor, Ts&& ... args)  {
+
+    if (stages_.empty())  {
+        group_col_names_.push_back(col_name);
+        (group_col_names_.push_back(std::get<0>(args)), ...);
+    }
+
+    // The visitors are copied per run, so collect() can be called again
+    //
+    stages_.push_back(
+        [col_name,
+         idx_visitor = typename std::decay<I_V>::type(
+             std::forward<I_V>(idx_visitor)),
+         triples = std::make_tuple(args ...)](const Result &df) -> Result  {
+            auto    iv = idx_visitor;
+            auto    trps = triples;
+
+            return (std::apply(
+                [&df, col_name, &iv](auto & ... trp) -> Result  {
+                    return (df.template groupby1<T>(col_name, iv, trp ...));
+                },
+                trps));
+        });
+    return (*this);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::Query::Bitmap
+DataFrame<I, H>::Query::bitmap_() const  {
+
+    const size_type idx_s = df_.indices_.size();
+    Bitmap          bits;
+
+    if (filters_.empty())  {
+        const size_type tail = idx_s % 64;
+
+        bits.resize((idx_s + 63) / 64, ~std::uint64_t(0));
+        if (tail && ! bits.empty())
+            bits.back() = (std::uint64_t(1) << tail) - 1;
+        return (bits);
+    }
+
+    // Each predicate is evaluated into its own bitmap. They are independent,
+    // so they run in parallel. Then they are ANDed a word at a time.
+    //
+    StlVecType<Bitmap>  all_bits (filters_.size());
+    ColumnJobVector     jobs;
+
+    for (size_type i = 0; i < filters_.size(); ++i)
+        jobs.push_back([this, &all_bits, i]() -> void  {
+            filters_[i](all_bits[i]);
+        });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
+
+    bits = std::move(all_bits[0]);
+    for (size_type i = 1; i < all_bits.size(); ++i)
+        for (size_type w = 0; w < bits.size(); ++w)
+            bits[w] &= all_bits[i][w];
+    return (bits);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::Query::RowVec
+DataFrame<I, H>::Query::rows_() const  {
+
+    RowVec  rows;
+
+    if (filters_.empty())  {
+        rows.resize(df_.indices_.size());
+        std::iota(rows.begin(), rows.end(), 0);
+    }
+    else
+        _bitmap_rows_(bitmap_(), rows);
+    return (rows);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+typename DataFrame<I, H>::Query::Result
+DataFrame<I, H>::Query::collect() const  {
+
+    // Only the selected columns and the columns the first groupby() reads
+    // are gathered
+    //
+    StlVecType<const char *>    col_names;
+    auto                        add_name =
+        [&col_names](const char *name) -> void  {
+            for (const char *n : col_names)
+                if (! ::strcmp(n, name))  return;
+            col_names.push_back(name);
+        };
+
+    for (const char *name : col_names_)  add_name(name);
+    for (const char *name : group_col_names_)  add_name(name);
+
+    Result  res =
+        df_.template data_by_sel_cols_<Result, Ts ...>(rows_(), col_names);
+
+    for (const auto &stage : stages_)
+        res = stage(res);
+    return (res);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::Query::count() const  {
+
+    if (filters_.empty())  return (df_.indices_.size());
+
+    size_type   count = 0;
+
+    for (const auto word : bitmap_())
+        count += _popcount64_(word);
+    return (count);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename V>
+V &
+DataFrame<I, H>::Query::visit(const char *name, V &visitor) const  {
+
+    if (! stages_.empty())
+        throw NotFeasible("DataFrame::Query::visit(): ERROR: "
+                          "Cannot visit a query with groupby(). "
+                          "Use collect()");
+
+    const auto      &vec = df_.template get_column<T>(name);
+    const size_type vec_s = vec.size();
+    const T         nan_val = get_nan<T>();
+
+    visitor.pre();
+    for (const auto row : rows_())
+        visitor(df_.indices_[row], row < vec_s ? vec[row] : nan_val);
+    visitor.post();
+    return (visitor);
+}
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
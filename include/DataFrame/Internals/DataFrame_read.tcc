@@ -846,6 +846,7 @@ read (S &in_s,
     }
     else
         throw NotImplemented("read(): This io_format is not implemented");
+    touch_column(nullptr);
 
     return (true);
 }
@@ -101,6 +101,7 @@ void DataFrame<I, H>::remove_column (const char *name)  {
             break;
         }
     }
+    touch_column(name);
 
     return;
 }
@@ -216,6 +217,7 @@ DataFrame<I, H>::load_index(const ITR &begin, const ITR &end)  {
 
     indices_.clear();
     indices_.insert (indices_.end(), begin, end);
+    touch_column(nullptr);
     return (indices_.size());
 }
 
@@ -229,6 +231,7 @@ DataFrame<I, H>::load_index(IndexVecType &&idx)  {
                   "Only a StdDataFrame can call load_index()");
 
     indices_ = idx;
+    touch_column(nullptr);
     return (indices_.size());
 }
 
@@ -325,6 +328,7 @@ DataFrame<I, H>::append_index(Index2D<const ITR &> range)  {
     const size_type s = std::distance(range.begin, range.end);
 
     indices_.insert(indices_.end(), range.begin, range.end);
+    appended_(nullptr);
     return (s);
 }
 
@@ -338,6 +342,7 @@ DataFrame<I, H>::append_index(const IndexType &val)  {
                   "Only a StdDataFrame can call append_index()");
 
     indices_.push_back (val);
+    appended_(nullptr);
     return (1);
 }
 
@@ -396,6 +401,7 @@ load_column (const char *name,
             ret_cnt += 1;
         }
     }
+    touch_column(name);
 
     return (ret_cnt);
 }
@@ -450,6 +456,7 @@ load_result_as_column(V &visitor, const char *name, nan_policy padding)  {
     guard.release();
 
     *vec_ptr = std::move(new_col);
+    touch_column(name);
     return (ret_cnt);
 }
 
@@ -612,6 +619,7 @@ load_column (const char *name,
     }
 
     *vec_ptr = std::move(column);
+    touch_column(name);
     return (ret_cnt);
 }
 
@@ -751,6 +759,7 @@ append_column (const char *name,
             ret_cnt += 1;
         }
     }
+    appended_(name);
 
     return (ret_cnt);
 }
@@ -792,6 +801,7 @@ append_column (const char *name, const T &val, nan_policy padding)  {
             ret_cnt += 1;
         }
     }
+    appended_(name);
 
     return (ret_cnt);
 }
@@ -835,6 +845,193 @@ DataFrame<I, H>::append_row (IndexType *idx_val, Ts&& ... args)  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename T>
+void DataFrame<I, H>::bind_appender_column_ (const char *name)  {
+
+    ColumnVecType<T>    &vec = create_column<T>(name);
+    const size_type     idx_s = indices_.size();
+
+    if (vec.size() > idx_s)  {
+        char buffer [512];
+
+        snprintf(buffer, sizeof(buffer) - 1,
+                 "DataFrame::get_appender(): ERROR: "
+#ifdef _MSC_VER
+                 "column '%s' of size %zu is longer than index of size %zu",
+#else
+                 "column '%s' of size %lu is longer than index of size %lu",
+#endif // _MSC_VER
+                 name, vec.size(), idx_s);
+        throw InconsistentData (buffer);
+    }
+    if (vec.size() < idx_s)  {
+        vec.resize(idx_s, get_nan<T>());
+        touch_column(name);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+typename DataFrame<I, H>::template Appender<Ts ...> DataFrame<I, H>::
+get_appender(const std::array<const char *, sizeof...(Ts)> &col_names,
+             size_type block_size)  {
+
+    static_assert(std::is_base_of<HeteroVector<align_value>, DataVec>::value,
+                  "Only a StdDataFrame can call get_appender()");
+
+    // A column bound twice would be appended to twice per row
+    //
+    for (size_type i = 0; i < col_names.size(); ++i)
+        for (size_type j = i + 1; j < col_names.size(); ++j)
+            if (! ::strcmp(col_names[i], col_names[j]))  {
+                char buffer [512];
+
+                snprintf(buffer, sizeof(buffer) - 1,
+                         "DataFrame::get_appender(): ERROR: "
+                         "column '%s' is given more than once",
+                         col_names[i]);
+                throw DataFrameError (buffer);
+            }
+
+    return (get_appender_<Ts ...>(col_names,
+                                  block_size,
+                                  std::index_sequence_for<Ts ...> { }));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts, std::size_t ... Is>
+typename DataFrame<I, H>::template Appender<Ts ...> DataFrame<I, H>::
+get_appender_(const std::array<const char *, sizeof...(Ts)> &col_names,
+              size_type block_size,
+              std::index_sequence<Is ...>)  {
+
+    // Create all the columns first, since adding a column may move the
+    // others
+    //
+    (bind_appender_column_<Ts>(col_names[Is]), ...);
+
+    typename Appender<Ts ...>::ColumnPtrs   cols {
+        &(get_column<Ts>(col_names[Is])) ...
+    };
+
+    return (Appender<Ts ...>(*this, std::move(cols), block_size));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+DataFrame<I, H>::Appender<Ts ...>::
+Appender(DataFrame &df, ColumnPtrs &&cols, size_type block_size)
+    : df_(&df),
+      columns_(std::move(cols)),
+      block_size_(std::max(block_size, size_type(1)))  {   }
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+DataFrame<I, H>::Appender<Ts ...>::Appender(Appender &&that) noexcept
+    : df_(std::exchange(that.df_, nullptr)),
+      columns_(that.columns_),
+      block_size_(that.block_size_),
+      pending_(std::exchange(that.pending_, 0))  {   }
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+DataFrame<I, H>::Appender<Ts ...>::~Appender()  {
+
+    if (df_)  flush();
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::Appender<Ts ...>::grow_(size_type n)  {
+
+    // Grow by blocks, but never by less than half the size, so a long
+    // ingest does not copy the columns too many times
+    //
+    reserve(std::max({ n, block_size_, df_->indices_.size() / 2 }));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::Appender<Ts ...>::reserve(size_type n)  {
+
+    const size_type new_cap = df_->indices_.size() + n;
+
+    df_->indices_.reserve(new_cap);
+    std::apply([new_cap](auto * ... vecs) -> void  {
+                   (vecs->reserve(new_cap), ...);
+               },
+               columns_);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::Appender<Ts ...>::
+append(const IndexType &idx_val, const Ts & ... vals)  {
+
+    // All the vectors are reserved together. So checking the index is enough
+    //
+    if (df_->indices_.size() == df_->indices_.capacity())  grow_(1);
+
+    df_->indices_.push_back(idx_val);
+    std::apply([&vals ...](auto * ... vecs) -> void  {
+                   (vecs->push_back(vals), ...);
+               },
+               columns_);
+    pending_ += 1;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::Appender<Ts ...>::
+append(size_type n, const IndexType *idx_vals, const Ts * ... vals)  {
+
+    if (df_->indices_.size() + n > df_->indices_.capacity())  grow_(n);
+
+    df_->indices_.insert(df_->indices_.end(), idx_vals, idx_vals + n);
+    std::apply([n, vals ...](auto * ... vecs) -> void  {
+                   (vecs->insert(vecs->end(), vals, vals + n), ...);
+               },
+               columns_);
+    pending_ += n;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::Appender<Ts ...>::flush()  {
+
+    const size_type ret = pending_;
+
+    if (pending_ > 0)  {
+        pending_ = 0;
+        df_->appended_(nullptr);
+    }
+    return (ret);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename ... Ts>
 void DataFrame<I, H>::remove_data_by_idx (Index2D<IndexType> range)  {
@@ -861,6 +1058,7 @@ void DataFrame<I, H>::remove_data_by_idx (Index2D<IndexType> range)  {
 
         for (const auto &iter : column_list_)
             data_[iter.second].change(functor);
+        touch_column(nullptr);
     }
 
     return;
@@ -893,6 +1091,7 @@ void DataFrame<I, H>::remove_data_by_loc (Index2D<long> range)  {
 
         for (const auto &iter : column_list_)
             data_[iter.second].change(functor);
+        touch_column(nullptr);
 
         return;
     }
@@ -920,22 +1119,25 @@ void DataFrame<I, H>::remove_data_by_sel (const char *name, F &sel_functor)  {
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(indices_.size() / 2);
-    for (size_type i = 0; i < col_s; ++i)
-        if (sel_functor (indices_[i], vec[i]))
-            col_indices.push_back(i);
-
-    const sel_remove_functor_<Ts ...>   functor (col_indices);
+    _sel_rows_(0, col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
+
+    ColumnJobVector                     jobs;
+    const sel_remove_functor_<Ts ...>   functor (col_indices, &jobs);
     SpinGuard                           guard (lock_);
 
     for (const auto &col_citer : column_list_)
         data_[col_citer.second].change(functor);
+    jobs.push_back([this, &col_indices]() -> void  {
+        _remove_sorted_rows_(indices_, col_indices);
+    });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
     guard.release();
-
-    const size_type col_indices_s = col_indices.size();
-    size_type       del_count = 0;
-
-    for (size_type i = 0; i < col_indices_s; ++i)
-        indices_.erase(indices_.begin() + (col_indices[i] - del_count++));
+    touch_column(nullptr);
 
     return;
 }
@@ -957,26 +1159,29 @@ remove_data_by_sel (const char *name1, const char *name2, F &sel_functor)  {
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor (indices_[i], vec1[i], vec2[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
                          i < col_s2 ? vec2[i] : get_nan<T2>()))
             col_indices.push_back(i);
 
-    const sel_remove_functor_<Ts ...>   functor (col_indices);
+    ColumnJobVector                     jobs;
+    const sel_remove_functor_<Ts ...>   functor (col_indices, &jobs);
 
     for (const auto &col_citer : column_list_)
         data_[col_citer.second].change(functor);
+    jobs.push_back([this, &col_indices]() -> void  {
+        _remove_sorted_rows_(indices_, col_indices);
+    });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
     guard.release();
-
-    const size_type col_indices_s = col_indices.size();
-    size_type       del_count = 0;
-
-    for (size_type i = 0; i < col_indices_s; ++i)
-        indices_.erase(indices_.begin() + (col_indices[i] - del_count++));
+    touch_column(nullptr);
 
     return;
 }
@@ -1003,9 +1208,13 @@ remove_data_by_sel (const char *name1,
     StlVecType<size_type>   col_indices;
 
     col_indices.reserve(idx_s / 2);
-    for (size_type i = 0; i < min_col_s; ++i)
-        if (sel_functor (indices_[i], vec1[i], vec2[i], vec3[i]))
-            col_indices.push_back(i);
+    _sel_rows_(0, min_col_s,
+               [&](size_type i) -> bool  {
+                   return (sel_functor(indices_[i], vec1[i], vec2[i],
+                                       vec3[i]));
+               },
+               col_indices,
+               sel_thread_level_<F>());
     for (size_type i = min_col_s; i < idx_s; ++i)
         if (sel_functor (indices_[i],
                          i < col_s1 ? vec1[i] : get_nan<T1>(),
@@ -1013,17 +1222,17 @@ remove_data_by_sel (const char *name1,
                          i < col_s3 ? vec3[i] : get_nan<T3>()))
             col_indices.push_back(i);
 
-    const sel_remove_functor_<Ts ...>   functor (col_indices);
+    ColumnJobVector                     jobs;
+    const sel_remove_functor_<Ts ...>   functor (col_indices, &jobs);
 
     for (const auto &col_citer : column_list_)
         data_[col_citer.second].change(functor);
+    jobs.push_back([this, &col_indices]() -> void  {
+        _remove_sorted_rows_(indices_, col_indices);
+    });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
     guard.release();
-
-    const size_type col_indices_s = col_indices.size();
-    size_type       del_count = 0;
-
-    for (size_type i = 0; i < col_indices_s; ++i)
-        indices_.erase(indices_.begin() + (col_indices[i] - del_count++));
+    touch_column(nullptr);
 
     return;
 }
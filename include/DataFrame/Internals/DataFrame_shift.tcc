@@ -75,6 +75,7 @@ void DataFrame<I, H>::self_shift(size_type periods, shift_policy sp)  {
             }
             for (size_type idx = 0; idx < thread_count; ++idx)
                 futures[idx].get();
+            touch_column(nullptr);
         }
         else if (sp == shift_policy::left)  {
             while (periods-- > 0)
@@ -159,6 +160,7 @@ void DataFrame<I, H>::self_rotate(size_type periods, shift_policy sp)  {
             }
             for (size_type idx = 0; idx < thread_count; ++idx)
                 futures[idx].get();
+            touch_column(nullptr);
         }
         else if (sp == shift_policy::left)  {
             std::rotate(column_list_.begin(),
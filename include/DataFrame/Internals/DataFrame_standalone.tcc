@@ -30,12 +30,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <DataFrame/Utils/DateTime.h>
+#include <DataFrame/Utils/Utils.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 // ----------------------------------------------------------------------------
@@ -54,292 +66,996 @@ _create_column_from_triple_(DF &df, T &triple) {
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V, typename V>
+// It finds where each group ends in the groupby column(s) and appends the
+// end positions to ends.
+// The positions are in the order given by sort_v. If sort_v is empty, the
+// groupby column(s) are assumed to be already clustered and the positions
+// are row numbers.
+// diff_func(i, j) must return true if rows i and j belong to different groups
+//
+template<typename S, typename F>
 static inline void
-_load_groupby_data_1_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V &input_v,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name) {
+_get_groupby_ends_(S &ends,
+                   const S &sort_v,
+                   std::size_t vec_size,
+                   F &&diff_func)  {
 
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size = input_v.size();
-    const auto          &src_idx = source.get_index();
+    std::size_t marker = 0;
 
-    if (dst_idx.empty())  {
-        using ColValueType = typename V::value_type;
-
-        auto    *col_vec =
-            ::strcmp(col_name, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType>(col_name))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec)  col_vec->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_v[sort_v[i]] != input_v[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec)  col_vec->push_back(input_v[sort_v[i - 1]]);
-                marker = i;
-            }
-        }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec)  col_vec->push_back(input_v[sort_v[vec_size - 1]]);
+    for (std::size_t i = 1; i < vec_size; ++i)  {
+        const bool  is_diff =
+            sort_v.empty() ? diff_func(i, marker)
+                           : diff_func(sort_v[i], sort_v[marker]);
+
+        if (is_diff)  {
+            ends.push_back(i);
+            marker = i;
         }
     }
+    if (vec_size > 0)  ends.push_back(vec_size);
+}
 
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
+// ----------------------------------------------------------------------------
 
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
+// It runs the visitor over each group specified by ends (see above) and
+// appends the result of each group to result.
+// If src_vec is shorter than the groupby column(s), the groups past its end
+// are not included.
+//
+template<typename SI, typename SV, typename S, typename VIS, typename R>
+static inline void
+_groupby_aggregate_(const SI &src_idx,
+                    const SV &src_vec,
+                    const S &sort_v,
+                    const S &ends,
+                    VIS &visitor,
+                    R &result)  {
+
+    const std::size_t   max_count =
+        ends.empty() ? 0 : std::min(ends.back(), src_vec.size());
+    std::size_t         marker = 0;
 
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i)  {
-        if (input_v[sort_v[i]] != input_v[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
-        }
-    }
-    if (marker < max_count || max_count == 1)  {
+    result.reserve(result.size() + ends.size());
+    for (std::size_t end : ends)  {
+        if (marker >= max_count)  break;
+
+        end = std::min(end, max_count);
         visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
+        if (sort_v.empty())
+            for (std::size_t j = marker; j < end; ++j)
+                visitor(src_idx[j], src_vec[j]);
         else
-            for (std::size_t j = marker; j < max_count; ++j)
+            for (std::size_t j = marker; j < end; ++j)
                 visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
         visitor.post();
-        dst_vec.push_back(visitor.get_result());
+        result.push_back(visitor.get_result());
+        marker = end;
     }
 }
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V, typename V1, typename V2>
+// It appends the groupby column value of each group to result
+//
+template<typename V, typename S, typename R>
 static inline void
-_load_groupby_data_2_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V1 &input_v1,
-    const V2 &input_v2,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name1,
-    const char *col_name2) {
+_groupby_keys_(const V &input_v, const S &sort_v, const S &ends, R &result)  {
 
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size = std::min(input_v1.size(), input_v2.size());
-    const auto          &src_idx = source.get_index();
+    result.reserve(result.size() + ends.size());
+    for (const std::size_t end : ends)
+        result.push_back(input_v[sort_v.empty() ? end - 1 : sort_v[end - 1]]);
+}
 
-    if (dst_idx.empty())  {
-        using ColValueType1 = typename V1::value_type;
-        using ColValueType2 = typename V2::value_type;
-
-        auto    *col_vec1 =
-            ::strcmp(col_name1, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType1>(col_name1))
-                : nullptr;
-        auto    *col_vec2 =
-            ::strcmp(col_name2, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType2>(col_name2))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec1) col_vec1->reserve(vec_size / 2 + 1);
-        if (col_vec2) col_vec2->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_v1[sort_v[i]] != input_v1[sort_v[marker]] ||
-                input_v2[sort_v[i]] != input_v2[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec1) col_vec1->push_back(input_v1[sort_v[i - 1]]);
-                if (col_vec2) col_vec2->push_back(input_v2[sort_v[i - 1]]);
-                marker = i;
-            }
+// ----------------------------------------------------------------------------
+
+// It runs all the jobs on up to thread_level threads. The calling thread is
+// one of them. Each thread keeps taking the next job that is not taken yet,
+// so jobs with uneven costs are balanced.
+//
+template<typename V>
+static inline void
+_run_jobs_in_parallel_(V &jobs, std::size_t thread_level)  {
+
+    const std::size_t   job_s = jobs.size();
+    const std::size_t   thr_s = std::min(job_s, thread_level);
+
+    if (thr_s < 2)  {
+        for (auto &job : jobs)  job();
+        return;
+    }
+
+    std::atomic<std::size_t>        next_job { 0 };
+    auto                            worker =
+        [&jobs, &next_job, job_s]() -> void  {
+            for (std::size_t i = next_job++; i < job_s; i = next_job++)
+                jobs[i]();
+        };
+    std::vector<std::future<void>>  futures;
+
+    futures.reserve(thr_s - 1);
+    for (std::size_t t = 1; t < thr_s; ++t)
+        futures.push_back(std::async(std::launch::async, worker));
+    worker();
+    for (auto &fut : futures)  fut.get();
+}
+
+// ----------------------------------------------------------------------------
+
+// It finds the rhs row that matches lhs_key according to ap. The candidate
+// rhs rows are row_at(0) to row_at(rows_s - 1), in ascending index order.
+// lo and hi are the number of candidates with index < and <= the previous
+// lhs key. Since lhs keys come in ascending order, they only move forward,
+// and the whole join is one linear pass.
+// It returns max size_t if there is no match within tolerance.
+// If T has no distance (See supports_distance), tolerance is not applied
+// and ap must not be nearest. _check_asof_policy_() verifies that upfront.
+//
+template<typename T, typename V, typename F>
+static std::size_t
+_asof_match_(const T &lhs_key,
+             const V &rhs_idx,
+             const F &row_at,
+             std::size_t rows_s,
+             std::size_t &lo,
+             std::size_t &hi,
+             asof_policy ap,
+             double tolerance)  {
+
+    constexpr std::size_t   npos = std::numeric_limits<std::size_t>::max();
+
+    while (lo < rows_s && rhs_idx[row_at(lo)] < lhs_key)  lo += 1;
+    if (hi < lo)  hi = lo;
+    while (hi < rows_s && ! (lhs_key < rhs_idx[row_at(hi)]))  hi += 1;
+
+    std::size_t backward = npos;
+    std::size_t forward = npos;
+    double      backward_dist = 0;
+    double      forward_dist = 0;
+
+    if (ap != asof_policy::forward && hi > 0)  {
+        backward = row_at(hi - 1);
+        if constexpr (supports_distance<T>::value)  {
+            backward_dist = static_cast<double>(lhs_key - rhs_idx[backward]);
+            if (backward_dist > tolerance)  backward = npos;
         }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec1) col_vec1->push_back(input_v1[sort_v[vec_size - 1]]);
-            if (col_vec2) col_vec2->push_back(input_v2[sort_v[vec_size - 1]]);
+    }
+    if (ap != asof_policy::backward && lo < rows_s)  {
+        forward = row_at(lo);
+        if constexpr (supports_distance<T>::value)  {
+            forward_dist = static_cast<double>(rhs_idx[forward] - lhs_key);
+            if (forward_dist > tolerance)  forward = npos;
         }
     }
+    if (backward == npos)  return (forward);
+    if (forward == npos)  return (backward);
+    return (forward_dist < backward_dist ? forward : backward);
+}
 
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
+// ----------------------------------------------------------------------------
 
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
+// The nearest policy and a tolerance need the distance between two indices
+//
+template<typename T>
+static void
+_check_asof_policy_(asof_policy ap, double tolerance)  {
+
+    if constexpr (! supports_distance<T>::value)
+        if (ap == asof_policy::nearest ||
+            tolerance != std::numeric_limits<double>::max())
+            throw NotFeasible("join_asof(): The nearest policy and tolerance "
+                              "need an index type whose difference converts "
+                              "to double");
+}
 
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i)  {
-        if (input_v1[sort_v[i]] != input_v1[sort_v[marker]] ||
-            input_v2[sort_v[i]] != input_v2[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
-        }
+// ----------------------------------------------------------------------------
+
+// It appends to rows, in ascending order, the rows in [begin, end) for
+// which pred(row) is true. With threads, the range is filtered in chunks
+// into their own buffers in parallel. Then the buffers are copied into rows
+// at the offsets given by a prefix sum of their sizes.
+// pred must be safe to call from many threads at once.
+//
+template<typename P, typename S>
+static void
+_sel_rows_(std::size_t begin,
+           std::size_t end,
+           P &&pred,
+           S &rows,
+           std::size_t thread_level)  {
+
+    constexpr std::size_t   min_chunk_s = 16 * 1024;
+    const std::size_t       rows_s = end > begin ? end - begin : 0;
+
+    if (thread_level < 2 || rows_s < 2 * min_chunk_s)  {
+        for (std::size_t i = begin; i < end; ++i)
+            if (pred(i))  rows.push_back(i);
+        return;
     }
-    if (marker < max_count || max_count == 1)  {
-        visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
-        else
-            for (std::size_t j = marker; j < max_count; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-        visitor.post();
-        dst_vec.push_back(visitor.get_result());
+
+    const std::size_t               chunk_s =
+        std::max(rows_s / (thread_level * 4) + 1, min_chunk_s);
+    const std::size_t               chunks = (rows_s + chunk_s - 1) / chunk_s;
+    std::vector<std::vector<std::size_t>>   buffers (chunks);
+    std::vector<std::function<void()>>      jobs;
+
+    jobs.reserve(chunks);
+    for (std::size_t c = 0; c < chunks; ++c)
+        jobs.push_back(
+            [&pred, &buffers, c,
+             c_begin = begin + c * chunk_s,
+             c_end = std::min(begin + (c + 1) * chunk_s, end)]() -> void  {
+                auto    &buffer = buffers[c];
+
+                buffer.reserve((c_end - c_begin) / 2);
+                for (std::size_t i = c_begin; i < c_end; ++i)
+                    if (pred(i))  buffer.push_back(i);
+            });
+    _run_jobs_in_parallel_(jobs, thread_level);
+
+    std::vector<std::size_t>    offsets (chunks + 1, rows.size());
+
+    for (std::size_t c = 0; c < chunks; ++c)
+        offsets[c + 1] = offsets[c] + buffers[c].size();
+    rows.resize(offsets[chunks]);
+
+    jobs.clear();
+    for (std::size_t c = 0; c < chunks; ++c)
+        jobs.push_back([&buffers, &rows, &offsets, c]() -> void  {
+            std::copy(buffers[c].begin(), buffers[c].end(),
+                      rows.begin() + offsets[c]);
+        });
+    _run_jobs_in_parallel_(jobs, thread_level);
+}
+
+// ----------------------------------------------------------------------------
+
+// It sets bit i of bits, for i < min(vec.size(), rows), if test(vec[i]) is
+// true. bits must be zeroed and hold at least (rows + 63) / 64 words.
+// Each word is computed by a branch-free loop over 64 values, which
+// compilers vectorize for arithmetic types.
+//
+template<typename V, typename F, typename B>
+static void
+_sel_bitmap_(const V &vec,
+             std::size_t rows,
+             const F &test,
+             B &bits,
+             std::size_t thread_level)  {
+
+    constexpr std::size_t   min_chunk_words = 1024;
+    const std::size_t       col_s = std::min(vec.size(), rows);
+    const std::size_t       full_words = col_s / 64;
+    auto                    fill_words =
+        [&vec, &test, &bits](std::size_t w_begin,
+                             std::size_t w_end) -> void  {
+            for (std::size_t w = w_begin; w < w_end; ++w)  {
+                const std::size_t   base = w * 64;
+                std::uint64_t       word = 0;
+
+                for (std::size_t b = 0; b < 64; ++b)
+                    word |= std::uint64_t(test(vec[base + b])) << b;
+                bits[w] = word;
+            }
+        };
+
+    if (thread_level < 2 || full_words < 2 * min_chunk_words)
+        fill_words(0, full_words);
+    else  {
+        const std::size_t                   chunk_s =
+            std::max(full_words / (thread_level * 4) + 1, min_chunk_words);
+        std::vector<std::function<void()>>  jobs;
+
+        for (std::size_t w = 0; w < full_words; w += chunk_s)
+            jobs.push_back(
+                [&fill_words, w,
+                 w_end = std::min(w + chunk_s, full_words)]() -> void  {
+                    fill_words(w, w_end);
+                });
+        _run_jobs_in_parallel_(jobs, thread_level);
     }
+
+    std::uint64_t   word = 0;
+
+    for (std::size_t i = full_words * 64; i < col_s; ++i)
+        word |= std::uint64_t(test(vec[i])) << (i % 64);
+    if (word)  bits[full_words] = word;
 }
 
 // ----------------------------------------------------------------------------
 
-template<typename DF, typename T, typename I_V,
-         typename V1, typename V2, typename V3>
-static inline void
-_load_groupby_data_3_(
-    const DF &source,
-    DF &dest,
-    T &triple,
-    I_V &&idx_visitor,
-    const V1 &input_v1,
-    const V2 &input_v2,
-    const V3 &input_v3,
-    const typename DF::template StlVecType<std::size_t> &sort_v,
-    const char *col_name1,
-    const char *col_name2,
-    const char *col_name3) {
+inline static std::size_t
+_popcount64_(std::uint64_t word)  {
 
-    std::size_t         marker = 0;
-    auto                &dst_idx = dest.get_index();
-    const std::size_t   vec_size =
-        std::min({ input_v1.size(), input_v2.size(), input_v3.size() });
-    const auto          &src_idx = source.get_index();
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) +
+           ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (std::size_t((word * 0x0101010101010101ULL) >> 56));
+}
 
-    if (dst_idx.empty())  {
-        using ColValueType1 = typename V1::value_type;
-        using ColValueType2 = typename V2::value_type;
-        using ColValueType3 = typename V3::value_type;
-
-        auto    *col_vec1 =
-            ::strcmp(col_name1, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType1>(col_name1))
-                : nullptr;
-        auto    *col_vec2 =
-            ::strcmp(col_name2, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType2>(col_name2))
-                : nullptr;
-        auto    *col_vec3 =
-            ::strcmp(col_name3, DF_INDEX_COL_NAME)
-                ? &(dest.template create_column<ColValueType3>(col_name3))
-                : nullptr;
-
-        dst_idx.reserve(vec_size / 2 + 1);
-        if (col_vec1) col_vec1->reserve(vec_size / 2 + 1);
-        if (col_vec2) col_vec2->reserve(vec_size / 2 + 1);
-        if (col_vec3) col_vec3->reserve(vec_size / 2 + 1);
-        for (std::size_t i = 0; i < vec_size; ++i)  {
-            if (input_v1[sort_v[i]] != input_v1[sort_v[marker]] ||
-                input_v2[sort_v[i]] != input_v2[sort_v[marker]] ||
-                input_v3[sort_v[i]] != input_v3[sort_v[marker]])  {
-                idx_visitor.pre();
-                for (std::size_t j = marker; j < i; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-                idx_visitor.post();
-                dst_idx.push_back(idx_visitor.get_result());
-                if (col_vec1) col_vec1->push_back(input_v1[sort_v[i - 1]]);
-                if (col_vec2) col_vec2->push_back(input_v2[sort_v[i - 1]]);
-                if (col_vec3) col_vec3->push_back(input_v3[sort_v[i - 1]]);
-                marker = i;
+// ----------------------------------------------------------------------------
+
+// It appends the positions of the set bits of bits to rows, in order
+//
+template<typename B, typename S>
+static void
+_bitmap_rows_(const B &bits, S &rows)  {
+
+    std::size_t count = 0;
+
+    for (const std::uint64_t word : bits)
+        count += _popcount64_(word);
+    rows.reserve(rows.size() + count);
+
+    const std::size_t   words = bits.size();
+
+    for (std::size_t w = 0; w < words; ++w)  {
+        std::uint64_t   word = bits[w];
+
+        for (std::size_t b = w * 64; word; ++b, word >>= 1)
+            if (word & 1)  rows.push_back(b);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It computes the running op() of col_s values, starting at column_begin,
+// into result. This is the scan behind CumSumVisitor, CumProdVisitor, and
+// CumExtremumVisitor. op() must be associative.
+// If has_init is false, the first value of the column is the initial value.
+// If skip_nan is true, NaN values are copied to result and do not change the
+// running value.
+// If thread_level is 2 or more and the column is large, it is a two-pass
+// blocked scan:
+//   1) Each block is scanned on its own, in parallel, and its total is kept.
+//   2) The block totals are scanned in order into each block's carry.
+//   3) Each block combines its carry into its values, in parallel.
+//
+template<typename T, typename H, typename R, typename OP>
+static void
+_cum_scan_(const H &column_begin,
+           std::size_t col_s,
+           const T &init,
+           bool has_init,
+           bool skip_nan,
+           OP op,
+           R &result,
+           std::size_t thread_level)  {
+
+    constexpr std::size_t   min_block_s = 64 * 1024;
+
+    result.resize(col_s);
+    if (col_s == 0)  return;
+
+    const std::size_t   block_cnt =
+        thread_level < 2 ? 1
+                         : std::max<std::size_t>(
+                               std::min<std::size_t>(thread_level,
+                                                     col_s / min_block_s),
+                               1);
+    const std::size_t   block_s = col_s / block_cnt;
+    std::vector<T>      totals(block_cnt);
+    std::vector<char>   has_totals(block_cnt, 0);
+
+    // Values before first_pos of a block had nothing to combine with yet.
+    // That only happens without has_init, for NaN values.
+    //
+    std::vector<std::size_t>    first_pos(block_cnt);
+    auto                        scan_block =
+        [&column_begin, &init, has_init, skip_nan, &op, &result,
+         &totals, &has_totals, &first_pos, block_s, block_cnt, col_s]
+        (std::size_t blk) -> void  {
+            const std::size_t   b = blk * block_s;
+            const std::size_t   e = blk + 1 == block_cnt ? col_s : b + block_s;
+            bool                has_value = has_init || blk == 0;
+            T                   running = has_init ? init : *column_begin;
+
+            first_pos[blk] = has_value ? b : e;
+            for (std::size_t i = b; i < e; ++i)  {
+                const T &value = *(column_begin + i);
+
+                if (skip_nan && is_nan__(value))  {
+                    result[i] = value;
+                    continue;
+                }
+                if (has_value)
+                    running = op(running, value);
+                else if (! is_nan__(value))  {
+                    running = value;
+                    has_value = true;
+                    first_pos[blk] = i;
+                }
+                else  {
+                    result[i] = value;
+                    continue;
+                }
+                result[i] = running;
             }
+            totals[blk] = running;
+            has_totals[blk] = has_value;
+        };
+
+    if (block_cnt == 1)  {
+        scan_block(0);
+        return;
+    }
+
+    std::vector<std::future<void>>  futures;
+
+    futures.reserve(block_cnt);
+    for (std::size_t blk = 0; blk < block_cnt; ++blk)
+        futures.push_back(std::async(std::launch::async, scan_block, blk));
+    for (auto &fut : futures)  fut.get();
+
+    // The first block always has a value, so every carry is defined
+    //
+    std::vector<T>  carries(block_cnt);
+
+    carries[1] = totals[0];
+    for (std::size_t blk = 2; blk < block_cnt; ++blk)
+        carries[blk] = has_totals[blk - 1]
+                           ? op(carries[blk - 1], totals[blk - 1])
+                           : carries[blk - 1];
+
+    futures.clear();
+    for (std::size_t blk = 1; blk < block_cnt; ++blk)
+        futures.push_back(std::async(
+            std::launch::async,
+            [&column_begin, skip_nan, &op, &result, &carries, &first_pos,
+             block_s, block_cnt, col_s, blk]() -> void  {
+                const std::size_t   b = blk * block_s;
+                const std::size_t   e =
+                    blk + 1 == block_cnt ? col_s : b + block_s;
+                const T             &carry = carries[blk];
+
+                for (std::size_t i = b; i < e; ++i)  {
+                    if (skip_nan && is_nan__(*(column_begin + i)))
+                        continue;
+                    result[i] = i < first_pos[blk]
+                                    ? carry : op(carry, result[i]);
+                }
+            }));
+    for (auto &fut : futures)  fut.get();
+}
+
+// ----------------------------------------------------------------------------
+
+// It evaluates the linear recurrences behind the exponentially weighted
+// visitors over col_s values. S is the state of the recurrences at a
+// position and init is the state before the first value.
+//   block(b, e) returns what the values in [b, e) add to a zero state.
+//   carry(state, added, b, e) returns the state at e, given the state at b
+//     and what block(b, e) returned.
+//   emit(b, e, state) runs the recurrences over [b, e) from state and writes
+//     the results.
+// If thread_level is 2 or more and the column is large, the blocks are
+// summed in parallel, their carries are chained in order, and then the
+// blocks are emitted in parallel. Otherwise, it is one emit() over the column.
+//
+template<typename S, typename BLK, typename CRY, typename EMT>
+static void
+_ewm_scan_(std::size_t col_s,
+           const S &init,
+           BLK block,
+           CRY carry,
+           EMT emit,
+           std::size_t thread_level)  {
+
+    constexpr std::size_t   min_block_s = 64 * 1024;
+
+    const std::size_t   block_cnt =
+        thread_level < 2 ? 1
+                         : std::max<std::size_t>(
+                               std::min<std::size_t>(thread_level,
+                                                     col_s / min_block_s),
+                               1);
+
+    if (block_cnt == 1)  {
+        emit(std::size_t(0), col_s, init);
+        return;
+    }
+
+    const std::size_t               block_s = col_s / block_cnt;
+    std::vector<S>                  added(block_cnt - 1);
+    std::vector<std::future<void>>  futures;
+
+    // The last block adds to nothing after it
+    //
+    futures.reserve(block_cnt);
+    for (std::size_t blk = 0; blk < block_cnt - 1; ++blk)
+        futures.push_back(std::async(
+            std::launch::async,
+            [&block, &added, block_s, blk]() -> void  {
+                added[blk] = block(blk * block_s, (blk + 1) * block_s);
+            }));
+    for (auto &fut : futures)  fut.get();
+
+    std::vector<S>  states(block_cnt);
+
+    states[0] = init;
+    for (std::size_t blk = 1; blk < block_cnt; ++blk)
+        states[blk] = carry(states[blk - 1], added[blk - 1],
+                            (blk - 1) * block_s, blk * block_s);
+
+    futures.clear();
+    for (std::size_t blk = 0; blk < block_cnt; ++blk)
+        futures.push_back(std::async(
+            std::launch::async,
+            [&emit, &states, block_s, block_cnt, col_s, blk]() -> void  {
+                const std::size_t   b = blk * block_s;
+
+                emit(b, blk + 1 == block_cnt ? col_s : b + block_s,
+                     states[blk]);
+            }));
+    for (auto &fut : futures)  fut.get();
+}
+
+// ----------------------------------------------------------------------------
+
+// It runs N exponentially weighted sums over col_s positions through
+// _ewm_scan_(). sums[0] is the sum of weights and sums[1] is the sum of
+// squared weights. terms(i, t) sets the rest of the terms at position i,
+// from t[2] on. emit(i, sums) is called with the sums at each position.
+// Every sum but sums[1] decays by decay_comp at each position.
+//
+template<typename T, std::size_t N, typename TRM, typename EMT>
+static void
+_ewm_sums_scan_(std::size_t col_s,
+                const T &decay_comp,
+                TRM terms,
+                EMT emit,
+                std::size_t thread_level)  {
+
+    using sums_t = std::array<T, N>;
+
+    sums_t  decays;
+    sums_t  zero;
+
+    decays.fill(decay_comp);
+    decays[1] = decay_comp * decay_comp;
+    zero.fill(T(0));
+
+    const auto  step =
+        [&terms, &decays](std::size_t i, sums_t &sums) -> void  {
+            sums_t  t;
+
+            t[0] = t[1] = T(1);
+            terms(i, t);
+            for (std::size_t k = 0; k < N; ++k)
+                sums[k] = decays[k] * sums[k] + t[k];
+        };
+
+    _ewm_scan_(
+        col_s, zero,
+        [&step, &zero](std::size_t b, std::size_t e) -> sums_t  {
+            sums_t  sums = zero;
+
+            for (std::size_t i = b; i < e; ++i)  step(i, sums);
+            return (sums);
+        },
+        [&decay_comp](const sums_t &state, const sums_t &added,
+                      std::size_t b, std::size_t e) -> sums_t  {
+            const T factor = std::pow(decay_comp, T(e - b));
+            sums_t  sums;
+
+            for (std::size_t k = 0; k < N; ++k)
+                sums[k] =
+                    (k == 1 ? factor * factor : factor) * state[k] + added[k];
+            return (sums);
+        },
+        [&step, &emit](std::size_t b, std::size_t e,
+                       const sums_t &state) -> void  {
+            sums_t  sums = state;
+
+            for (std::size_t i = b; i < e; ++i)  {
+                step(i, sums);
+                emit(i, sums);
+            }
+        },
+        thread_level);
+}
+
+// ----------------------------------------------------------------------------
+
+// It appends the describe() statistics of vec to stats, in the order of
+// describe_index_col.
+// Count, missing, mean, min, max, and variance (Welford) are computed in one
+// pass that also copies the non-missing values into a scratch vector. The
+// quartiles are then selected from the scratch vector with nth_element(),
+// each selection only searching to the right of the previous one.
+// The quartiles follow QuantileVisitor with quantile_policy::mid_point.
+//
+template<typename V, typename S>
+static void
+_describe_col_(const V &vec, S &stats)  {
+
+    using value_type = typename V::value_type;
+
+    const std::size_t       vec_s = vec.size();
+    std::vector<value_type> scratch;
+    std::size_t             missing_cnt = 0;
+    value_type              minv { };
+    value_type              maxv { };
+    value_type              sum { };
+    double                  mean = 0;
+    double                  m2 = 0;
+
+    scratch.reserve(vec_s);
+    for (const auto &val : vec)  {
+        if (is_nan(val))  {
+            missing_cnt += 1;
+            continue;
         }
-        if (marker < vec_size || vec_size == 1)  {
-            idx_visitor.pre();
-            if (vec_size == 1)
-                idx_visitor(src_idx[sort_v[0]], src_idx[sort_v[0]]);
-            else
-                for (std::size_t j = marker; j < vec_size; ++j)
-                    idx_visitor(src_idx[sort_v[j]], src_idx[sort_v[j]]);
-            idx_visitor.post();
-            dst_idx.push_back(idx_visitor.get_result());
-            if (col_vec1) col_vec1->push_back(input_v1[sort_v[vec_size - 1]]);
-            if (col_vec2) col_vec2->push_back(input_v2[sort_v[vec_size - 1]]);
-            if (col_vec3) col_vec3->push_back(input_v3[sort_v[vec_size - 1]]);
+        if (scratch.empty())
+            minv = maxv = sum = val;
+        else  {
+            if (val > maxv)  maxv = val;
+            if (val < minv)  minv = val;
+            sum += val;
         }
+        scratch.push_back(val);
+
+        const double    delta = double(val) - mean;
+
+        mean += delta / double(scratch.size());
+        m2 += delta * (double(val) - mean);
     }
 
-    using ValueType = typename std::tuple_element<2, T>::type::value_type;
+    constexpr double    nan = std::numeric_limits<double>::quiet_NaN();
+    const std::size_t   n = scratch.size();
+
+    stats.push_back(double(vec_s));
+    stats.push_back(double(missing_cnt));
+    stats.push_back(n > 0 ? double(sum) / double(n) : nan);
+    stats.push_back(n > 1 ? std::sqrt(m2 / double(n - 1)) : nan);
+    stats.push_back(n > 0 ? double(minv) : nan);
+    stats.push_back(n > 0 ? double(maxv) : nan);
+    if (n == 0)  {
+        stats.insert(stats.end(), 3, nan);
+        return;
+    }
 
-    const auto          &src_vec =
-        source.template get_column<ValueType>(std::get<0>(triple));
-    const std::size_t   max_count = std::min(vec_size, src_vec.size());
-    auto                &dst_vec = _create_column_from_triple_(dest, triple);
-    auto                &visitor = std::get<2>(triple);
+    // Each quartile needs the k-th and maybe the (k + 1)-th smallest value
+    //
+    const double        qts[] = { 0.25, 0.5, 0.75 };
+    std::size_t         firsts[3];
+    bool                need_seconds[3];
+    std::vector<std::size_t>    positions;
+
+    for (std::size_t i = 0; i < 3; ++i)  {
+        const double        frac = qts[i] * double(n);
+        const std::size_t   k =
+            std::max(static_cast<std::size_t>(std::round(frac)),
+                     std::size_t(1));
+
+        firsts[i] = k - 1;
+        need_seconds[i] = (! (n & 0x01) || double(k) < frac) && k + 1 < n;
+        positions.push_back(k - 1);
+        if (need_seconds[i])  positions.push_back(k);
+    }
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()),
+                    positions.end());
 
-    dst_vec.reserve(max_count / 2 + 1);
-    marker = 0;
-    for (std::size_t i = 0; i < max_count; ++i)  {
-        if (input_v1[sort_v[i]] != input_v1[sort_v[marker]] ||
-            input_v2[sort_v[i]] != input_v2[sort_v[marker]] ||
-            input_v3[sort_v[i]] != input_v3[sort_v[marker]])  {
-            visitor.pre();
-            for (std::size_t j = marker; j < i; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-            visitor.post();
-            dst_vec.push_back(visitor.get_result());
-            marker = i;
+    std::size_t lo = 0;
+
+    for (const std::size_t pos : positions)  {
+        std::nth_element(scratch.begin() + lo,
+                         scratch.begin() + pos,
+                         scratch.end());
+        lo = pos + 1;
+    }
+    for (std::size_t i = 0; i < 3; ++i)  {
+        value_type  result = scratch[firsts[i]];
+
+        if (need_seconds[i])
+            result = value_type((result + scratch[firsts[i] + 1]) / 2.0);
+        stats.push_back(double(result));
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It removes the elements at sorted_rows from vec in one pass, shifting
+// the kept elements down. sorted_rows must be ascending. Rows past the end
+// of vec are ignored.
+//
+template<typename V, typename S>
+static void
+_remove_sorted_rows_(V &vec, const S &sorted_rows)  {
+
+    const std::size_t   vec_s = vec.size();
+    std::size_t         dst = 0;
+    std::size_t         src = 0;
+
+    for (const auto row : sorted_rows)  {
+        const std::size_t   del = static_cast<std::size_t>(row);
+
+        if (del >= vec_s)  break;
+        if (dst != src)
+            std::move(vec.begin() + src, vec.begin() + del,
+                      vec.begin() + dst);
+        dst += del - src;
+        src = del + 1;
+    }
+    if (src > dst)  {
+        std::move(vec.begin() + src, vec.end(), vec.begin() + dst);
+        vec.erase(vec.begin() + (vec_s - (src - dst)), vec.end());
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It appends to pairs a (point row, interval row) pair for every interval
+// [begins[j], ends[j]) that contains points[i], for the first rows_s rows.
+// Empty intervals match nothing. If keep_unmatched is true, points that are
+// in no interval, and rows past the end of points, are paired with max
+// size_t.
+// It sweeps the points in ascending order and keeps the open intervals in
+// a min-heap on their end, so it is O((n + m) log m) plus the output size.
+// Pairs are in point row order, and interval row order within each point.
+//
+template<typename T, typename PV, typename BV, typename EV, typename S>
+static void
+_interval_join_rows_(const PV &points,
+                     std::size_t rows_s,
+                     const BV &begins,
+                     const EV &ends,
+                     bool keep_unmatched,
+                     S &pairs)  {
+
+    constexpr std::size_t       npos = std::numeric_limits<std::size_t>::max();
+    const std::size_t           points_s = std::min(points.size(), rows_s);
+    const std::size_t           intervals_s =
+        std::min(begins.size(), ends.size());
+    const bool                  points_sorted =
+        std::is_sorted(points.begin(), points.begin() + points_s);
+    std::vector<std::size_t>    point_rows (points_s);
+    std::vector<std::size_t>    interval_rows;
+
+    std::iota(point_rows.begin(), point_rows.end(), 0);
+    if (! points_sorted)
+        std::stable_sort(point_rows.begin(), point_rows.end(),
+                         [&points](std::size_t a, std::size_t b) -> bool  {
+                             return (points[a] < points[b]);
+                         });
+
+    interval_rows.reserve(intervals_s);
+    for (std::size_t j = 0; j < intervals_s; ++j)
+        if (begins[j] < ends[j])
+            interval_rows.push_back(j);
+    std::stable_sort(interval_rows.begin(), interval_rows.end(),
+                     [&begins](std::size_t a, std::size_t b) -> bool  {
+                         return (begins[a] < begins[b]);
+                     });
+
+    auto                        later_end =
+        [&ends](std::size_t a, std::size_t b) -> bool  {
+            return (ends[b] < ends[a]);
+        };
+    std::vector<std::size_t>    open;
+    std::vector<std::size_t>    matches;
+    std::size_t                 next = 0;
+    const std::size_t           first_pair = pairs.size();
+
+    for (const std::size_t i : point_rows)  {
+        const T &point = points[i];
+
+        while (next < interval_rows.size() &&
+               ! (point < begins[interval_rows[next]]))  {
+            open.push_back(interval_rows[next++]);
+            std::push_heap(open.begin(), open.end(), later_end);
+        }
+        while (! open.empty() && ! (point < ends[open.front()]))  {
+            std::pop_heap(open.begin(), open.end(), later_end);
+            open.pop_back();
         }
+
+        // Every interval left open has begin <= point < end
+        //
+        matches.assign(open.begin(), open.end());
+        std::sort(matches.begin(), matches.end());
+        for (const std::size_t j : matches)
+            pairs.emplace_back(i, j);
+        if (matches.empty() && keep_unmatched)
+            pairs.emplace_back(i, npos);
     }
-    if (marker < max_count || max_count == 1)  {
-        visitor.pre();
-        if (max_count == 1)
-            visitor(src_idx[sort_v[0]], src_vec[sort_v[0]]);
-        else
-            for (std::size_t j = marker; j < max_count; ++j)
-                visitor(src_idx[sort_v[j]], src_vec[sort_v[j]]);
-        visitor.post();
-        dst_vec.push_back(visitor.get_result());
+
+    if (! points_sorted)
+        std::stable_sort(pairs.begin() + first_pair, pairs.end(),
+                         [](const auto &a, const auto &b) -> bool  {
+                             return (std::get<0>(a) < std::get<0>(b));
+                         });
+    if (keep_unmatched)
+        for (std::size_t i = points_s; i < rows_s; ++i)
+            pairs.emplace_back(i, npos);
+}
+
+// ----------------------------------------------------------------------------
+
+// It appends to rows the row numbers of lhs_vec whose values exist in
+// rhs_vec, or don't exist if anti is true.
+// The rhs values are put in a hash set, or in a sorted vector if T is not
+// hashable.
+//
+template<typename T, typename LV, typename RV, typename S>
+static void
+_semi_join_rows_(const LV &lhs_vec, const RV &rhs_vec, bool anti, S &rows)  {
+
+    const std::size_t   lhs_s = lhs_vec.size();
+
+    if constexpr (std::is_default_constructible<std::hash<T>>::value)  {
+        const std::unordered_set<T> rhs_keys (rhs_vec.begin(), rhs_vec.end());
+
+        for (std::size_t i = 0; i < lhs_s; ++i)
+            if ((rhs_keys.find(lhs_vec[i]) != rhs_keys.end()) != anti)
+                rows.push_back(i);
+    }
+    else  {
+        std::vector<T>  rhs_keys (rhs_vec.begin(), rhs_vec.end());
+
+        std::sort(rhs_keys.begin(), rhs_keys.end());
+        for (std::size_t i = 0; i < lhs_s; ++i)
+            if (std::binary_search(rhs_keys.begin(), rhs_keys.end(),
+                                   lhs_vec[i]) != anti)
+                rows.push_back(i);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+// It scatters the row numbers of vec into rows, grouped by the top bits of
+// their key hash. After this, the rows of partition p are
+// rows[offsets[p]] to rows[offsets[p + 1]] in ascending order.
+// offsets must have (1 << bits) + 1 entries.
+//
+template<typename T, typename HASH, typename V, typename S>
+static void
+_hash_partition_(const V &vec,
+                 unsigned int bits,
+                 S &rows,
+                 S &offsets,
+                 std::size_t thread_level)  {
+
+    const std::size_t               vec_s = vec.size();
+    const std::size_t               part_s = std::size_t(1) << bits;
+    const unsigned int              shift = 64 - bits;
+    std::vector<unsigned short>     part_ids(vec_s);
+    const std::size_t               chunk_s =
+        vec_s / std::max(thread_level, std::size_t(1)) + 1;
+    std::vector<std::function<void()>>  jobs;
+
+    for (std::size_t begin = 0; begin < vec_s; begin += chunk_s)
+        jobs.push_back(
+            [&vec, &part_ids, shift, begin,
+             end = std::min(begin + chunk_s, vec_s)]() -> void  {
+                for (std::size_t i = begin; i < end; ++i)
+                    part_ids[i] = static_cast<unsigned short>(
+                        (std::uint64_t(HASH()(vec[i])) *
+                         0x9E3779B97F4A7C15ULL) >> shift);
+            });
+    _run_jobs_in_parallel_(jobs, thread_level);
+
+    offsets.assign(part_s + 1, 0);
+    for (const auto id : part_ids)  offsets[id + 1] += 1;
+    for (std::size_t p = 1; p <= part_s; ++p)
+        offsets[p] += offsets[p - 1];
+
+    S   cursor (offsets.begin(), offsets.end() - 1);
+
+    rows.resize(vec_s);
+    for (std::size_t i = 0; i < vec_s; ++i)
+        rows[cursor[part_ids[i]]++] = i;
+}
+
+// ----------------------------------------------------------------------------
+
+// It matches rows of the build side (normally the smaller side) to rows of
+// the probe side with equal keys, using a hash table of the build side keys.
+// Equal keys are paired in order of appearance. The first occurrence of a
+// key on one side is paired with its first occurrence on the other side, the
+// second with the second, and so on. This is the same pairing that the
+// sort-merge join does.
+// The matching row numbers are written into build_match and probe_match,
+// which must be sized and filled with max size_t by the caller.
+// HASH is the hash functor for T.
+// Large inputs are radix partitioned by key hash first. The partitions are
+// independent and are joined on up to thread_level threads.
+//
+template<typename T, typename HASH, typename BV, typename PV, typename S>
+static void
+_hash_join_match_(const BV &build_vec,
+                  const PV &probe_vec,
+                  S &build_match,
+                  S &probe_match,
+                  std::size_t thread_level)  {
+
+    constexpr std::size_t   npos = std::numeric_limits<std::size_t>::max();
+    constexpr std::size_t   part_rows = 16 * 1024;
+    constexpr unsigned int  max_bits = 12;
+    const std::size_t       build_s = build_vec.size();
+    const std::size_t       probe_s = probe_vec.size();
+    S                       next (build_s, npos);
+
+    // Each key maps to its first unmatched build row. The rest of the build
+    // rows with the same key are chained through next.
+    //
+    auto    join_rows =
+        [&build_vec, &probe_vec, &build_match, &probe_match, &next]
+        (std::size_t b_s, const auto &b_row,
+         std::size_t p_s, const auto &p_row) -> void  {
+            std::unordered_map<T, std::size_t, HASH>    table;
+
+            table.reserve(b_s);
+            for (std::size_t i = b_s; i > 0; --i)  {
+                const std::size_t   row = b_row(i - 1);
+                auto                [iter, inserted] =
+                    table.try_emplace(build_vec[row], row);
+
+                if (! inserted)  {
+                    next[row] = iter->second;
+                    iter->second = row;
+                }
+            }
+            for (std::size_t i = 0; i < p_s; ++i)  {
+                const std::size_t   row = p_row(i);
+                auto                iter = table.find(probe_vec[row]);
+
+                if (iter != table.end() && iter->second != npos)  {
+                    build_match[iter->second] = row;
+                    probe_match[row] = iter->second;
+                    iter->second = next[iter->second];
+                }
+            }
+        };
+    auto    same_row = [](std::size_t i) -> std::size_t { return (i); };
+
+    if (build_s <= part_rows && (thread_level < 2 || probe_s <= part_rows))  {
+        join_rows(build_s, same_row, probe_s, same_row);
+        return;
+    }
+
+    unsigned int    bits = 1;
+
+    while (bits < max_bits &&
+           ((build_s >> bits) > part_rows ||
+            (std::size_t(1) << bits) < thread_level * 4))
+        bits += 1;
+
+    S   build_rows;
+    S   build_offsets;
+    S   probe_rows;
+    S   probe_offsets;
+
+    _hash_partition_<T, HASH>(build_vec, bits, build_rows, build_offsets,
+                              thread_level);
+    _hash_partition_<T, HASH>(probe_vec, bits, probe_rows, probe_offsets,
+                              thread_level);
+
+    const std::size_t                   part_s = std::size_t(1) << bits;
+    std::vector<std::function<void()>>  jobs;
+
+    jobs.reserve(part_s);
+    for (std::size_t p = 0; p < part_s; ++p)  {
+        const std::size_t   b_begin = build_offsets[p];
+        const std::size_t   p_begin = probe_offsets[p];
+
+        jobs.push_back(
+            [&join_rows, &build_rows, &probe_rows, b_begin, p_begin,
+             b_s = build_offsets[p + 1] - b_begin,
+             p_s = probe_offsets[p + 1] - p_begin]() -> void  {
+                join_rows(
+                    b_s,
+                    [&build_rows, b_begin](std::size_t i) -> std::size_t  {
+                        return (build_rows[b_begin + i]);
+                    },
+                    p_s,
+                    [&probe_rows, p_begin](std::size_t i) -> std::size_t  {
+                        return (probe_rows[p_begin + i]);
+                    });
+            });
     }
+    _run_jobs_in_parallel_(jobs, thread_level);
 }
 
 // ----------------------------------------------------------------------------
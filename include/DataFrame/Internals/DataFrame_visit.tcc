@@ -27,8 +27,11 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <cstring>
 #include <future>
 #include <tuple>
+#include <unordered_map>
 
 // ----------------------------------------------------------------------------
 
@@ -68,6 +71,111 @@ void DataFrame<I, H>::multi_visit(Ts ... args) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::multi_visit_fused (Ts ... args)  {
+
+    constexpr size_type block_s = 2048;
+    constexpr size_type args_s = sizeof...(Ts);
+    auto                args_tuple = std::tuple<Ts ...>(args ...);
+    const char          *names[args_s] = { args.first ... };
+    size_type           groups[args_s];
+    size_type           group_cnt = 0;
+
+    // Pairs on the same column make one group
+    //
+    for (size_type k = 0; k < args_s; ++k)  {
+        groups[k] = group_cnt;
+        for (size_type j = 0; j < k; ++j)
+            if (! ::strcmp(names[k], names[j]))  {
+                groups[k] = groups[j];
+                break;
+            }
+        if (groups[k] == group_cnt)  group_cnt += 1;
+    }
+
+    // Columns are looked up serially. Only the scans run in parallel.
+    //
+    const void  *cols[args_s];
+    size_type   k = 0;
+
+    for_each_in_tuple (args_tuple, [this, &cols, &k](auto &pa) -> void  {
+        using T =
+            typename std::remove_reference<
+                decltype(*(pa.second))>::type::value_type;
+
+        cols[k++] = &(this->get_column<T>(pa.first));
+    });
+
+    // Each column is streamed once, a block at a time. All the visitors of
+    // the column run over a block while it is still in cache.
+    //
+    const size_type idx_s = indices_.size();
+    ColumnJobVector jobs;
+
+    jobs.reserve(group_cnt);
+    for (size_type g = 0; g < group_cnt; ++g)
+        jobs.push_back(
+            [this, g, idx_s, &args_tuple, &groups, &cols]() -> void  {
+                auto    for_group = [&args_tuple, &groups, &cols, g]
+                                        (auto &&func) -> void  {
+                    size_type   i = 0;
+
+                    for_each_in_tuple (args_tuple,
+                                       [&func, &groups, &cols, &i, g]
+                                           (auto &pa) -> void  {
+                        using T =
+                            typename std::remove_reference<
+                                decltype(*(pa.second))>::type::value_type;
+
+                        if (groups[i] == g)
+                            func(*(pa.second),
+                                 *static_cast<const ColumnVecType<T> *>
+                                     (cols[i]));
+                        i += 1;
+                    });
+                };
+
+                for_group([](auto &visitor, const auto &) -> void  {
+                    visitor.pre();
+                });
+                for (size_type b = 0; b < idx_s; b += block_s)  {
+                    const size_type e = std::min(b + block_s, idx_s);
+
+                    for_group([this, b, e](auto &visitor,
+                                           const auto &vec) -> void  {
+                        using T = typename std::remove_reference<
+                            decltype(vec)>::type::value_type;
+
+                        const size_type min_e = std::min(e, vec.size());
+                        const T         nan_val = get_nan<T>();
+                        size_type       r = b;
+
+                        for (; r < min_e; ++r)
+                            visitor (indices_[r], vec[r]);
+                        for (; r < e; ++r)
+                            visitor (indices_[r], nan_val);
+                    });
+                }
+                for_group([](auto &visitor, const auto &) -> void  {
+                    visitor.post();
+                });
+            });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
+    return;
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename ... Ts>
+void DataFrame<I, H>::multi_visit_fused(Ts ... args) const  {
+
+    const_cast<DataFrame *>(this)->multi_visit_fused<Ts ...>(args ...);
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T, typename V>
 V &DataFrame<I, H>::visit (const char *name, V &visitor, bool in_reverse)  {
@@ -691,6 +799,9 @@ single_act_visit (const char *name, V &visitor, bool in_reverse)  {
 
     auto    &vec = get_column<T>(name);
 
+    const DerivedCache::Scope   scope (derived_cache_.get(),
+                                       { DerivedCache::column(name, vec) });
+
     visitor.pre();
     if (! in_reverse)
         visitor (indices_.begin(), indices_.end(), vec.begin(), vec.end());
@@ -748,6 +859,275 @@ single_act_visit_async(const char *name, V &visitor, bool in_reverse) const  {
 
 // ----------------------------------------------------------------------------
 
+template<typename I, typename H>
+template<typename T, typename V>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::
+single_act_visit_panel(const StlVecType<const char *> &col_names,
+                       const V &visitor,
+                       const StlVecType<const char *> &new_col_names,
+                       nan_policy padding)  {
+
+    const size_type col_cnt = col_names.size();
+
+    if (new_col_names.size() != col_cnt)
+        throw InconsistentData ("DataFrame::single_act_visit_panel(): ERROR: "
+                                "There must be one new column name for "
+                                "each column name");
+
+    // Columns are looked up serially. Only the visits run in parallel.
+    // The results are loaded afterwards, since creating a column could
+    // move the other columns.
+    //
+    StlVecType<const ColumnVecType<T> *>    cols;
+    std::vector<V>                          visitors(col_cnt, visitor);
+    ColumnJobVector                         jobs;
+
+    cols.reserve(col_cnt);
+    for (const char *name : col_names)
+        cols.push_back(&(get_column<T>(name)));
+
+    jobs.reserve(col_cnt);
+    for (size_type i = 0; i < col_cnt; ++i)
+        jobs.push_back([this,
+                        name = col_names[i],
+                        &vec = *(cols[i]),
+                        &v = visitors[i]]() -> void  {
+            const DerivedCache::Scope   scope (
+                derived_cache_.get(), { DerivedCache::column(name, vec) });
+
+            v.pre();
+            v (indices_.begin(), indices_.end(), vec.begin(), vec.end());
+            v.post();
+        });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
+
+    size_type   ret_cnt = 0;
+
+    for (size_type i = 0; i < col_cnt; ++i)
+        ret_cnt +=
+            load_result_as_column(visitors[i], new_col_names[i], padding);
+    return (ret_cnt);
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename KT, typename T, typename V>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::
+single_act_visit_grouped(const char *key_name,
+                         const char *col_name,
+                         const V &visitor,
+                         const char *new_col_name)  {
+
+    using new_type = typename V::result_type::value_type;
+
+    const auto      &key_vec = get_column<KT>(key_name);
+    const auto      &vec = get_column<T>(col_name);
+    const size_type idx_s = indices_.size();
+    const size_type row_s = std::min({ key_vec.size(), vec.size(), idx_s });
+
+    // One pass over the keys. Each group keeps its rows in order.
+    //
+    std::unordered_map<KT, size_type>   group_ids;
+    StlVecType<StlVecType<size_type>>   groups;
+
+    for (size_type r = 0; r < row_s; ++r)  {
+        const KT    &key = key_vec[r];
+
+        if (is_nan<KT>(key))  continue;
+
+        const auto  ins = group_ids.emplace(key, groups.size());
+
+        if (ins.second)  groups.emplace_back();
+        groups[ins.first->second].push_back(r);
+    }
+
+    // Each group is gathered, visited, and scattered back on its own.
+    // Groups do not share rows, so they write to different items. But
+    // std::vector<bool> packs items into shared words. Then each group keeps
+    // its result, and the results are scattered after all groups are done.
+    //
+    constexpr bool                      keep_results =
+        std::is_same<new_type, bool>::value;
+    StlVecType<new_type>                new_col(idx_s, get_nan<new_type>());
+    StlVecType<typename V::result_type> results(
+        keep_results ? groups.size() : 0);
+    ColumnJobVector                     jobs;
+    auto                                scatter =
+        [&new_col](const StlVecType<size_type> &rows,
+                   const typename V::result_type &result) -> void  {
+            const size_type res_s =
+                std::min(size_type(result.size()), size_type(rows.size()));
+
+            for (size_type i = 0; i < res_s; ++i)
+                new_col[rows[i]] = result[i];
+        };
+
+    jobs.reserve(groups.size());
+    for (size_type g = 0; g < groups.size(); ++g)
+        jobs.push_back([this, g, &groups, &vec, &visitor, &results,
+                        &scatter]() -> void  {
+            const auto      &rows = groups[g];
+            const size_type rows_s = rows.size();
+            IndexVecType    group_idx;
+            StlVecType<T>   group_vec;
+            V               group_visitor = visitor;
+
+            group_idx.reserve(rows_s);
+            group_vec.reserve(rows_s);
+            for (const size_type r : rows)  {
+                group_idx.push_back(indices_[r]);
+                group_vec.push_back(vec[r]);
+            }
+
+            group_visitor.pre();
+            group_visitor (group_idx.begin(), group_idx.end(),
+                           group_vec.begin(), group_vec.end());
+            group_visitor.post();
+
+            if constexpr (keep_results)
+                results[g] = group_visitor.get_result();
+            else
+                scatter(rows, group_visitor.get_result());
+        });
+    _run_jobs_in_parallel_(jobs, get_thread_level());
+    if constexpr (keep_results)
+        for (size_type g = 0; g < groups.size(); ++g)
+            scatter(groups[g], results[g]);
+
+    load_column<new_type>(new_col_name, std::move(new_col),
+                          nan_policy::dont_pad_with_nans);
+    return (groups.size());
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename V>
+void DataFrame<I, H>::
+subscribe_(V &visitor,
+           std::vector<std::string> &&col_names,
+           std::function<size_type(DataFrame &, size_type)> &&feed)  {
+
+    Subscription    sub;
+
+    sub.col_names = std::move(col_names);
+    sub.visitor = &visitor;
+    sub.feed = std::move(feed);
+    sub.fed_cnt = sub.feed(*this, 0);
+    subscriptions_.push_back(std::move(sub));
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T, typename V>
+void DataFrame<I, H>::subscribe(const char *name, V &visitor)  {
+
+    subscribe_(visitor,
+               { name },
+               [&visitor, col_name = std::string(name)]
+               (DataFrame &df, size_type from) -> size_type  {
+                   const ColumnVecType<T>  &vec =
+                       df.template get_column<T>(col_name.c_str());
+                   const size_type         row_s =
+                       std::min(df.indices_.size(), vec.size());
+
+                   if (from == 0)  visitor.pre();
+                   for (size_type i = from; i < row_s; ++i)
+                       visitor.update(df.indices_[i], vec[i]);
+                   return (row_s);
+               });
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T1, typename T2, typename V>
+void DataFrame<I, H>::
+subscribe(const char *name1, const char *name2, V &visitor)  {
+
+    subscribe_(visitor,
+               { name1, name2 },
+               [&visitor,
+                col_name1 = std::string(name1),
+                col_name2 = std::string(name2)]
+               (DataFrame &df, size_type from) -> size_type  {
+                   const ColumnVecType<T1> &vec1 =
+                       df.template get_column<T1>(col_name1.c_str());
+                   const ColumnVecType<T2> &vec2 =
+                       df.template get_column<T2>(col_name2.c_str());
+                   const size_type         row_s =
+                       std::min({ df.indices_.size(),
+                                  vec1.size(),
+                                  vec2.size() });
+
+                   if (from == 0)  visitor.pre();
+                   for (size_type i = from; i < row_s; ++i)
+                       visitor.update(df.indices_[i], vec1[i], vec2[i]);
+                   return (row_s);
+               });
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename T1, typename T2, typename T3, typename V>
+void DataFrame<I, H>::
+subscribe(const char *name1,
+          const char *name2,
+          const char *name3,
+          V &visitor)  {
+
+    subscribe_(visitor,
+               { name1, name2, name3 },
+               [&visitor,
+                col_name1 = std::string(name1),
+                col_name2 = std::string(name2),
+                col_name3 = std::string(name3)]
+               (DataFrame &df, size_type from) -> size_type  {
+                   const ColumnVecType<T1> &vec1 =
+                       df.template get_column<T1>(col_name1.c_str());
+                   const ColumnVecType<T2> &vec2 =
+                       df.template get_column<T2>(col_name2.c_str());
+                   const ColumnVecType<T3> &vec3 =
+                       df.template get_column<T3>(col_name3.c_str());
+                   const size_type         row_s =
+                       std::min({ df.indices_.size(),
+                                  vec1.size(),
+                                  vec2.size(),
+                                  vec3.size() });
+
+                   if (from == 0)  visitor.pre();
+                   for (size_type i = from; i < row_s; ++i)
+                       visitor.update(df.indices_[i],
+                                      vec1[i], vec2[i], vec3[i]);
+                   return (row_s);
+               });
+}
+
+// ----------------------------------------------------------------------------
+
+template<typename I, typename H>
+template<typename V>
+typename DataFrame<I, H>::size_type
+DataFrame<I, H>::unsubscribe(const V &visitor)  {
+
+    const size_type sub_s = subscriptions_.size();
+
+    subscriptions_.erase(
+        std::remove_if(subscriptions_.begin(), subscriptions_.end(),
+                       [&visitor](const Subscription &sub) -> bool  {
+                           return (sub.visitor == &visitor);
+                       }),
+        subscriptions_.end());
+    return (sub_s - subscriptions_.size());
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename I, typename H>
 template<typename T1, typename T2, typename V>
 V &DataFrame<I, H>::
@@ -761,6 +1141,12 @@ single_act_visit (const char *name1,
     const ColumnVecType<T2> &vec2 = get_column<T2>(name2, false);
 
     guard.release();
+
+    const DerivedCache::Scope   scope (
+        derived_cache_.get(),
+        { DerivedCache::column(name1, vec1),
+          DerivedCache::column(name2, vec2) });
+
     visitor.pre();
     if (! in_reverse)
         visitor (indices_.begin(), indices_.end(),
@@ -851,6 +1237,13 @@ single_act_visit (const char *name1,
     const ColumnVecType<T3> &vec3 = get_column<T3>(name3, false);
 
     guard.release();
+
+    const DerivedCache::Scope   scope (
+        derived_cache_.get(),
+        { DerivedCache::column(name1, vec1),
+          DerivedCache::column(name2, vec2),
+          DerivedCache::column(name3, vec3) });
+
     visitor.pre();
     if (! in_reverse)
         visitor (indices_.begin(), indices_.end(),
@@ -955,6 +1348,14 @@ single_act_visit (const char *name1,
     const ColumnVecType<T4> &vec4 = get_column<T4>(name4, false);
 
     guard.release();
+
+    const DerivedCache::Scope   scope (
+        derived_cache_.get(),
+        { DerivedCache::column(name1, vec1),
+          DerivedCache::column(name2, vec2),
+          DerivedCache::column(name3, vec3),
+          DerivedCache::column(name4, vec4) });
+
     visitor.pre();
     if (! in_reverse)
         visitor (indices_.begin(), indices_.end(),
@@ -1071,6 +1472,15 @@ single_act_visit (const char *name1,
     const ColumnVecType<T5> &vec5 = get_column<T5>(name5, false);
 
     guard.release();
+
+    const DerivedCache::Scope   scope (
+        derived_cache_.get(),
+        { DerivedCache::column(name1, vec1),
+          DerivedCache::column(name2, vec2),
+          DerivedCache::column(name3, vec3),
+          DerivedCache::column(name4, vec4),
+          DerivedCache::column(name5, vec5) });
+
     visitor.pre();
     if (! in_reverse)
         visitor (indices_.begin(), indices_.end(),
@@ -0,0 +1,564 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/Vectors/VectorView.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// A DataFrame that one thread appends to, while other threads read it
+// without locks.
+//
+// The rows live in a generation of fixed-capacity buffers. The writer
+// writes a row past the published row count and then publishes the new
+// count. So published rows are never written again, and a reader never
+// sees a buffer move. When a generation is full, the writer copies the
+// rows to a new one of twice the capacity and publishes it instead.
+//
+// A reader takes a Snapshot: the current generation and its row count.
+// A Snapshot is immutable. It can be read and visited with no lock, for
+// as long as it is held. While any Snapshot is held, retired generations
+// are kept. They are freed once the writer sees no reader (quiescent-state
+// reclamation, as in RCU). The memory kept is less than the capacity of
+// the current generation.
+//
+// NOTE: All the non-const methods must be called from one writer thread.
+//       snapshot() may be called from any thread. Snapshots must not
+//       outlive the LiveDataFrame.
+//
+// I: Index (e.g. Timestamp) type
+// A: Memory alignment of the buffers. See StdDataFrame<I>
+//
+template<typename I, std::size_t A = 0>
+class   LiveDataFrame : public ThreadGranularity  {
+
+public:
+
+    static constexpr std::size_t    align_value { A };
+
+    template<typename T>
+    using AllocatorType = typename allocator_declare<T, align_value>::type;
+
+    using size_type = std::size_t;
+    using IndexType = I;
+    using ColNameType = String64;
+    using DataFrameType = DataFrame<I, HeteroVector<align_value>>;
+
+    template<typename T>
+    using ColumnVecType = std::vector<T, AllocatorType<T>>;
+    template<typename T>
+    using ColumnViewType = VectorConstView<T, align_value>;
+
+private:
+
+    struct  Column_;
+    struct  Generation_;
+
+public:
+
+    // An immutable view of the first size() rows of a LiveDataFrame.
+    // It is cheap to take and to copy. Reading it takes no lock.
+    //
+    class   Snapshot  {
+
+    public:
+
+        Snapshot() = delete;
+        inline Snapshot(const Snapshot &that) noexcept
+            : gen_(that.gen_), size_(that.size_), readers_(that.readers_)  {
+
+            readers_->fetch_add(1, std::memory_order_seq_cst);
+        }
+        inline Snapshot(Snapshot &&that) noexcept
+            : gen_(that.gen_),
+              size_(that.size_),
+              readers_(std::exchange(that.readers_, nullptr))  {   }
+        Snapshot &operator= (const Snapshot &) = delete;
+        Snapshot &operator= (Snapshot &&) = delete;
+        inline ~Snapshot()  {
+
+            if (readers_)
+                readers_->fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        size_type size() const noexcept  { return (size_); }
+        bool empty() const noexcept  { return (size_ == 0); }
+        size_type col_num() const noexcept  { return (gen_->columns.size()); }
+        bool has_column(const char *name) const  {
+
+            return (gen_->column_tb.find(name) != gen_->column_tb.end());
+        }
+
+        // It returns a view of the index
+        //
+        ColumnViewType<IndexType>
+        get_index() const noexcept  {
+
+            const IndexType *buf = gen_->indices.data();
+
+            return (ColumnViewType<IndexType>(buf, buf + size_));
+        }
+
+        // It returns a view of the named column
+        //
+        // T:
+        //   Type of the column
+        // name:
+        //   Name of the column
+        //
+        template<typename T>
+        ColumnViewType<T>
+        get_column(const char *name) const  {
+
+            const T *buf = buffer_<T>(name);
+
+            return (ColumnViewType<T>(buf, buf + size_));
+        }
+
+        // They run the visitor over the named column(s), the same way
+        // DataFrame::single_act_visit() does. No lock is taken
+        //
+        // T:
+        //   Type of the named column
+        // V:
+        //   Type of the visitor functor
+        // name:
+        //   Name of the data column
+        // visitor:
+        //   A reference to a visitor functor
+        // in_reverse:
+        //   If true, it will iterate over the column in reverse order
+        //
+        template<typename T, typename V>
+        V &
+        single_act_visit(const char *name,
+                         V &visitor,
+                         bool in_reverse = false) const  {
+
+            const IndexType *idx = gen_->indices.data();
+            const T         *vec = buffer_<T>(name);
+
+            visitor.pre();
+            if (! in_reverse)
+                visitor (idx, idx + size_, vec, vec + size_);
+            else
+                visitor (std::make_reverse_iterator(idx + size_),
+                         std::make_reverse_iterator(idx),
+                         std::make_reverse_iterator(vec + size_),
+                         std::make_reverse_iterator(vec));
+            visitor.post();
+
+            return (visitor);
+        }
+
+        // Same as above, for visitors of two columns
+        //
+        template<typename T1, typename T2, typename V>
+        V &
+        single_act_visit(const char *name1,
+                         const char *name2,
+                         V &visitor,
+                         bool in_reverse = false) const  {
+
+            const IndexType *idx = gen_->indices.data();
+            const T1        *vec1 = buffer_<T1>(name1);
+            const T2        *vec2 = buffer_<T2>(name2);
+
+            visitor.pre();
+            if (! in_reverse)
+                visitor (idx, idx + size_,
+                         vec1, vec1 + size_,
+                         vec2, vec2 + size_);
+            else
+                visitor (std::make_reverse_iterator(idx + size_),
+                         std::make_reverse_iterator(idx),
+                         std::make_reverse_iterator(vec1 + size_),
+                         std::make_reverse_iterator(vec1),
+                         std::make_reverse_iterator(vec2 + size_),
+                         std::make_reverse_iterator(vec2));
+            visitor.post();
+
+            return (visitor);
+        }
+
+        // It copies the rows into a regular DataFrame
+        //
+        DataFrameType
+        to_dataframe() const  {
+
+            DataFrameType   df;
+            const auto      idx = get_index();
+
+            df.load_index(idx.begin(), idx.end());
+            for (const auto &col : gen_->columns)
+                col.copy_to(col, size_, df);
+            return (df);
+        }
+
+    private:
+
+        friend class    LiveDataFrame;
+
+        inline Snapshot(const Generation_ *gen,
+                        size_type sz,
+                        std::atomic<size_type> *readers) noexcept
+            : gen_(gen), size_(sz), readers_(readers)  {   }
+
+        template<typename T>
+        const T *
+        buffer_(const char *name) const  {
+
+            return (static_cast<const T *>(
+                        gen_->columns[
+                            gen_->template col_index<T>(name)].buffer));
+        }
+
+        const Generation_       *gen_;
+        size_type               size_;
+        std::atomic<size_type>  *readers_;
+    };
+
+public:
+
+    // init_cap: Initial capacity in rows. It doubles as rows are appended
+    //
+    explicit
+    LiveDataFrame(size_type init_cap = 1024)
+        : head_(new Generation_(std::max(init_cap, size_type(1))))  {
+
+        current_.store(head_.get(), std::memory_order_seq_cst);
+    }
+    LiveDataFrame(const LiveDataFrame &) = delete;
+    LiveDataFrame(LiveDataFrame &&) = delete;
+    LiveDataFrame &operator= (const LiveDataFrame &) = delete;
+    LiveDataFrame &operator= (LiveDataFrame &&) = delete;
+    ~LiveDataFrame() = default;
+
+public:  // Writer interfaces
+
+    // It creates a column named name. The rows that are already in the
+    // frame are filled with NaN (or T() if there is no NaN for T).
+    // It publishes a new generation, so it is best done before the rows
+    // start coming in.
+    //
+    // T:
+    //   Type of the column
+    // name:
+    //   Name of the column
+    //
+    template<typename T>
+    void
+    create_column(const char *name)  {
+
+        static_assert(! std::is_same<T, bool>::value,
+                      "LiveDataFrame columns need continuous memory. "
+                      "Use char instead of bool");
+
+        if (! ::strcmp(name, DF_INDEX_COL_NAME))
+            throw DataFrameError ("LiveDataFrame::create_column(): ERROR: "
+                                  "Data column name cannot be 'INDEX'");
+        if (head_->column_tb.find(name) != head_->column_tb.end())  {
+            head_->template col_index<T>(name);  // Throws if not a T column
+            return;
+        }
+
+        std::unique_ptr<Generation_>    gen = clone_(head_->capacity);
+        Column_                         col;
+
+        col.name = name;
+        col.type = std::type_index(typeid(T));
+        col.elem_size = sizeof(T);
+        col.make = &make_column_<T>;
+        col.copy_to = &copy_to_<T>;
+        col.make(col, nullptr, 0, gen->capacity);
+        gen->column_tb.emplace(name, gen->columns.size());
+        gen->columns.push_back(std::move(col));
+        publish_(std::move(gen));
+    }
+
+    // It appends a row. The row is visible to snapshots taken after this
+    // returns. Columns that are not in args get NaN (or T()) for this row.
+    // It returns the number of items written, including the index.
+    //
+    // Ts:
+    //   The list of types for columns in args
+    // idx_val:
+    //   The index value of the new row
+    // args:
+    //   A variable list of arguments consisting of
+    //     std::pair(<const char *name, &&data>).
+    //   Each pair, represents a pair of column name and a single column value.
+    //   The columns must already exist
+    //
+    template<typename ... Ts>
+    size_type
+    append_row(const IndexType &idx_val, Ts&& ... args)  {
+
+        size_type   col_idxs[sizeof...(Ts) + 1] { };
+        size_type   i = 0;
+
+        ((col_idxs[i++] =
+              head_->template col_index<
+                  typename std::decay<decltype(args.second)>::type>
+                      (args.first)), ...);
+
+        const size_type slot = head_->size.load(std::memory_order_relaxed);
+
+        if (slot == head_->capacity)  publish_(clone_(head_->capacity * 2));
+        if (! retired_.empty())  reclaim();
+
+        Generation_ &gen = *head_;
+
+        gen.indices[slot] = idx_val;
+        i = 0;
+        ((static_cast<typename std::decay<decltype(args.second)>::type *>(
+              gen.columns[col_idxs[i++]].buffer)[slot] =
+                  std::forward<Ts>(args).second), ...);
+        gen.size.store(slot + 1, std::memory_order_release);
+
+        return (sizeof...(Ts) + 1);
+    }
+
+    // It frees the retired generations, if no snapshot is held.
+    // It returns the number of generations freed. append_row() calls it.
+    //
+    size_type
+    reclaim()  {
+
+        const size_type ret = retired_.size();
+
+        if (ret > 0 && readers_.load(std::memory_order_seq_cst) == 0)  {
+            retired_.clear();
+            return (ret);
+        }
+        return (0);
+    }
+
+public:  // Reader interfaces
+
+    // It returns a snapshot of the rows appended so far. It is safe to call
+    // from any thread, while the writer appends
+    //
+    Snapshot
+    snapshot() const  {
+
+        readers_.fetch_add(1, std::memory_order_seq_cst);
+
+        const Generation_   *gen = current_.load(std::memory_order_seq_cst);
+
+        return (Snapshot(gen,
+                         gen->size.load(std::memory_order_acquire),
+                         &readers_));
+    }
+
+    // These are only exact on the writer thread
+    //
+    size_type size() const noexcept  {
+
+        return (current_.load(std::memory_order_acquire)->size.load(
+                    std::memory_order_acquire));
+    }
+    size_type capacity() const noexcept  {
+
+        return (current_.load(std::memory_order_acquire)->capacity);
+    }
+    size_type retired_count() const noexcept  { return (retired_.size()); }
+
+private:
+
+    using ColNameDict =
+        std::unordered_map<ColNameType,
+                           size_type,
+                           std::hash<VirtualString>,
+                           std::equal_to<ColNameType>>;
+
+    // A column owns its buffer through a type-erased shared_ptr, so readers
+    // never go through HeteroVector's shared type tables
+    //
+    struct  Column_  {
+
+        using make_t =
+            void (*)(Column_ &, const Column_ *, size_type, size_type);
+        using copy_to_t =
+            void (*)(const Column_ &, size_type, DataFrameType &);
+
+        ColNameType             name { };
+        std::type_index         type { typeid(void) };
+        size_type               elem_size { 0 };
+        std::shared_ptr<void>   holder { };
+        void                    *buffer { nullptr };
+        make_t                  make { nullptr };
+        copy_to_t               copy_to { nullptr };
+    };
+
+    struct  Generation_  {
+
+        explicit Generation_(size_type cap) : capacity(cap), indices(cap)  {  }
+
+        // It also checks that the column is of type T, since its buffer is
+        // cast to T
+        //
+        template<typename T>
+        size_type col_index(const char *name) const  {
+
+            const auto  iter = column_tb.find (name);
+
+            if (iter == column_tb.end())  {
+                char buffer [512];
+
+                snprintf (buffer, sizeof(buffer) - 1,
+                          "LiveDataFrame: ERROR: Cannot find column '%s'",
+                          name);
+                throw ColNotFound (buffer);
+            }
+
+            const Column_   &col = columns[iter->second];
+
+            if (col.type != std::type_index(typeid(T)) ||
+                col.elem_size != sizeof(T))  {
+                char buffer [512];
+
+                snprintf (buffer, sizeof(buffer) - 1,
+                          "LiveDataFrame: ERROR: "
+                          "Column '%s' is not of type %s",
+                          name, typeid(T).name());
+                throw DataFrameError (buffer);
+            }
+            return (iter->second);
+        }
+
+        const size_type             capacity;
+        std::atomic<size_type>      size { 0 };
+        ColumnVecType<IndexType>    indices;
+        std::vector<Column_>        columns { };
+        ColNameDict                 column_tb { };
+    };
+
+    // It makes the buffer of dst with capacity cap, filled with NaN, and
+    // copies the first n items of src into it
+    //
+    template<typename T>
+    static void
+    make_column_(Column_ &dst,
+                 const Column_ *src,
+                 size_type n,
+                 size_type cap)  {
+
+        auto    vec = std::make_shared<ColumnVecType<T>>(cap, get_nan<T>());
+
+        if (src)
+            std::copy(static_cast<const T *>(src->buffer),
+                      static_cast<const T *>(src->buffer) + n,
+                      vec->begin());
+        dst.buffer = vec->data();
+        dst.holder = std::move(vec);
+    }
+
+    template<typename T>
+    static void
+    copy_to_(const Column_ &col, size_type n, DataFrameType &df)  {
+
+        const T *buf = static_cast<const T *>(col.buffer);
+
+        df.template load_column<T>(col.name.c_str(),
+                                   ColumnVecType<T>(buf, buf + n),
+                                   nan_policy::dont_pad_with_nans);
+    }
+
+    // It copies the current generation into a new one of capacity cap
+    //
+    std::unique_ptr<Generation_>
+    clone_(size_type cap) const  {
+
+        const size_type                 n =
+            head_->size.load(std::memory_order_relaxed);
+        std::unique_ptr<Generation_>    gen(new Generation_(cap));
+
+        std::copy(head_->indices.begin(), head_->indices.begin() + n,
+                  gen->indices.begin());
+        gen->columns.reserve(head_->columns.size() + 1);
+        for (const auto &col : head_->columns)  {
+            Column_ new_col;
+
+            new_col.name = col.name;
+            new_col.type = col.type;
+            new_col.elem_size = col.elem_size;
+            new_col.make = col.make;
+            new_col.copy_to = col.copy_to;
+            new_col.make(new_col, &col, n, cap);
+            gen->columns.push_back(std::move(new_col));
+        }
+        gen->column_tb = head_->column_tb;
+        gen->size.store(n, std::memory_order_relaxed);
+        return (gen);
+    }
+
+    // It makes gen the current generation and retires the old one
+    //
+    void
+    publish_(std::unique_ptr<Generation_> &&gen)  {
+
+        current_.store(gen.get(), std::memory_order_seq_cst);
+        retired_.push_back(std::move(head_));
+        head_ = std::move(gen);
+    }
+
+    std::unique_ptr<Generation_>                head_;  // Writer's view
+    std::atomic<const Generation_ *>            current_ { nullptr };
+    mutable std::atomic<size_type>              readers_ { 0 };
+    std::vector<std::unique_ptr<Generation_>>   retired_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,452 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/DataFrame.h>
+#include <DataFrame/Vectors/RingView.h>
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// A DataFrame of a fixed capacity that keeps the last capacity() rows.
+// The index and each column are circular buffers that share one head.
+// Appending a row to a full ring evicts the oldest row in O(1), instead of
+// moving all the columns, as remove_data_by_loc() would. This is meant for
+// live windows, such as the last N ticks of an intraday feed.
+//
+// Columns are accessed through RingViews. Visitors are passed ring
+// iterators that wrap around the end of the buffers, so they see the rows
+// in order, oldest first. RingView::segments() gives the rows as two
+// continuous spans, for loops that want raw memory.
+//
+// I: Index (e.g. Timestamp) type
+// A: Memory alignment of the buffers. See StdDataFrame<I>
+//
+template<typename I, std::size_t A = 0>
+class   RingDataFrame : public ThreadGranularity  {
+
+public:
+
+    static constexpr std::size_t    align_value { A };
+
+    template<typename T>
+    using AllocatorType = typename allocator_declare<T, align_value>::type;
+
+    using size_type = std::size_t;
+    using IndexType = I;
+    using ColNameType = String64;
+    using DataFrameType = DataFrame<I, HeteroVector<align_value>>;
+
+    template<typename T>
+    using ColumnVecType = std::vector<T, AllocatorType<T>>;
+    template<typename T>
+    using ColumnViewType = RingView<T>;
+    template<typename T>
+    using ConstColumnViewType = RingView<const T>;
+
+    RingDataFrame() = delete;
+    RingDataFrame(const RingDataFrame &) = default;
+    RingDataFrame(RingDataFrame &&) = default;
+    RingDataFrame &operator= (const RingDataFrame &) = default;
+    RingDataFrame &operator= (RingDataFrame &&) = default;
+    ~RingDataFrame() = default;
+
+    // cap: Maximum number of rows. It must be positive
+    //
+    explicit
+    RingDataFrame(size_type cap) : capacity_(cap), indices_(cap)  {
+
+        static_assert(! std::is_same<IndexType, bool>::value,
+                      "RingDataFrame index cannot be bool");
+
+        if (cap == 0)
+            throw NotFeasible ("RingDataFrame(): ERROR: "
+                               "Capacity must be positive");
+    }
+
+public:  // Load/append/remove interfaces
+
+    // It creates an empty column named name. The rows that are already
+    // in the ring are filled with NaN (or T() if there is no NaN for T).
+    // If the column already exists, it is returned as it is.
+    //
+    // T:
+    //   Type of the column
+    // name:
+    //   Name of the column
+    //
+    template<typename T>
+    ColumnViewType<T>
+    create_column(const char *name)  {
+
+        static_assert(! std::is_same<T, bool>::value,
+                      "RingDataFrame columns need continuous memory. "
+                      "Use char instead of bool");
+
+        if (! ::strcmp(name, DF_INDEX_COL_NAME))
+            throw DataFrameError ("RingDataFrame::create_column(): ERROR: "
+                                  "Data column name cannot be 'INDEX'");
+        if (column_tb_.find(name) != column_tb_.end())
+            return (get_column<T>(name));
+
+        data_.emplace_back();
+
+        ColumnSlot_ &col = data_.back();
+
+        col.name = name;
+        col.type = std::type_index(typeid(T));
+        col.data.template get_vector<T>().resize(capacity_, get_nan<T>());
+        col.reset_slot = [](HeteroVector<align_value> &hv, size_type slot)  {
+            hv.template get_vector<T>()[slot] = get_nan<T>();
+        };
+        col.copy_to = [](const RingDataFrame &rdf,
+                         const ColumnSlot_ &that,
+                         DataFrameType &df)  {
+            const auto  view = rdf.template get_column<T>(that.name.c_str());
+
+            df.template load_column<T>(
+                that.name.c_str(),
+                ColumnVecType<T>(view.begin(), view.end()),
+                nan_policy::dont_pad_with_nans);
+        };
+        column_tb_.emplace (name, data_.size() - 1);
+        return (get_column<T>(name));
+    }
+
+    // It appends a row to the end of the ring. If the ring is full, the
+    // oldest row is evicted first. This does not move any data and it is
+    // O(1) in the number of rows.
+    // Columns that are not in args get NaN (or T()) for this row.
+    // It returns the number of items written, including the index.
+    //
+    // Ts:
+    //   The list of types for columns in args
+    // idx_val:
+    //   The index value of the new row
+    // args:
+    //   A variable list of arguments consisting of
+    //     std::pair(<const char *name, &&data>).
+    //   Each pair, represents a pair of column name and a single column value.
+    //   The columns must already exist
+    //
+    template<typename ... Ts>
+    size_type
+    append_row(const IndexType &idx_val, Ts&& ... args)  {
+
+        // Find all the columns before changing anything
+        //
+        size_type   col_idxs[sizeof...(Ts) + 1] { };
+        size_type   i = 0;
+
+        ((col_idxs[i++] =
+              col_index_<typename std::decay<decltype(args.second)>::type>
+                  (args.first)), ...);
+
+        if (size_ == capacity_)  {
+            head_ = next_(head_);
+            size_ -= 1;
+        }
+
+        const size_type slot = slot_(size_);
+
+        size_ += 1;
+        indices_[slot] = idx_val;
+        for (auto &col : data_)
+            col.reset_slot(col.data, slot);
+
+        i = 0;
+        ((data_[col_idxs[i++]].data.template get_vector<
+              typename std::decay<decltype(args.second)>::type>()[slot] =
+                  std::forward<Ts>(args).second), ...);
+
+        return (sizeof...(Ts) + 1);
+    }
+
+    // It drops the oldest n rows, or all rows if n is larger than size().
+    // Nothing is moved. It returns the number of rows dropped.
+    //
+    size_type
+    evict(size_type n = 1) noexcept  {
+
+        if (n > size_)  n = size_;
+        head_ = (head_ + n) % capacity_;
+        size_ -= n;
+        if (size_ == 0)  head_ = 0;
+        return (n);
+    }
+
+    // It drops all rows, but keeps the columns
+    //
+    void clear() noexcept  { head_ = size_ = 0; }
+
+public:  // Data access
+
+    size_type capacity() const noexcept  { return (capacity_); }
+    size_type size() const noexcept  { return (size_); }
+    bool empty() const noexcept  { return (size_ == 0); }
+    bool full() const noexcept  { return (size_ == capacity_); }
+    size_type col_num() const noexcept  { return (data_.size()); }
+    bool has_column(const char *name) const  {
+
+        return (column_tb_.find(name) != column_tb_.end());
+    }
+
+    // They return a view of the index, oldest row first
+    //
+    ColumnViewType<IndexType>
+    get_index()  {
+
+        return (ColumnViewType<IndexType>(indices_.data(),
+                                          capacity_, head_, size_));
+    }
+    ConstColumnViewType<IndexType>
+    get_index() const  {
+
+        return (ConstColumnViewType<IndexType>(indices_.data(),
+                                               capacity_, head_, size_));
+    }
+
+    // They return a view of the named column, oldest row first. The view
+    // stays valid until the ring is changed.
+    //
+    // T:
+    //   Type of the column
+    // name:
+    //   Name of the column
+    //
+    template<typename T>
+    ColumnViewType<T>
+    get_column(const char *name)  {
+
+        auto    &vec =
+            data_[col_index_<T>(name)].data.template get_vector<T>();
+
+        return (ColumnViewType<T>(vec.data(), capacity_, head_, size_));
+    }
+    template<typename T>
+    ConstColumnViewType<T>
+    get_column(const char *name) const  {
+
+        const auto  &vec =
+            data_[col_index_<T>(name)].data.template get_vector<T>();
+
+        return (ConstColumnViewType<T>(vec.data(), capacity_, head_, size_));
+    }
+
+    // It copies the rows, oldest first, into a regular DataFrame
+    //
+    DataFrameType
+    to_dataframe() const  {
+
+        DataFrameType   df;
+        const auto      idx = get_index();
+
+        df.load_index(idx.begin(), idx.end());
+        for (const auto &col : data_)
+            col.copy_to(*this, col, df);
+        return (df);
+    }
+
+public:  // Visitors
+
+    // They run the visitor over the named column(s), the same way
+    // DataFrame::single_act_visit() does. The visitor is passed ring
+    // iterators, so it sees the rows in order across the wraparound.
+    //
+    // T:
+    //   Type of the named column
+    // V:
+    //   Type of the visitor functor
+    // name:
+    //   Name of the data column
+    // visitor:
+    //   A reference to a visitor functor
+    // in_reverse:
+    //   If true, it will iterate over the column in reverse order
+    //
+    template<typename T, typename V>
+    V &
+    single_act_visit(const char *name, V &visitor, bool in_reverse = false)  {
+
+        auto    idx = get_index();
+        auto    vec = get_column<T>(name);
+
+        visitor.pre();
+        if (! in_reverse)
+            visitor (idx.begin(), idx.end(), vec.begin(), vec.end());
+        else
+            visitor (idx.rbegin(), idx.rend(), vec.rbegin(), vec.rend());
+        visitor.post();
+
+        return (visitor);
+    }
+
+    template<typename T, typename V>
+    V &
+    single_act_visit(const char *name,
+                     V &visitor,
+                     bool in_reverse = false) const  {
+
+        return (const_cast<RingDataFrame *>(this)->single_act_visit<T, V>
+                    (name, visitor, in_reverse));
+    }
+
+    // Same as above, for visitors of two columns
+    //
+    template<typename T1, typename T2, typename V>
+    V &
+    single_act_visit(const char *name1,
+                     const char *name2,
+                     V &visitor,
+                     bool in_reverse = false)  {
+
+        auto    idx = get_index();
+        auto    vec1 = get_column<T1>(name1);
+        auto    vec2 = get_column<T2>(name2);
+
+        visitor.pre();
+        if (! in_reverse)
+            visitor (idx.begin(), idx.end(),
+                     vec1.begin(), vec1.end(),
+                     vec2.begin(), vec2.end());
+        else
+            visitor (idx.rbegin(), idx.rend(),
+                     vec1.rbegin(), vec1.rend(),
+                     vec2.rbegin(), vec2.rend());
+        visitor.post();
+
+        return (visitor);
+    }
+
+    template<typename T1, typename T2, typename V>
+    V &
+    single_act_visit(const char *name1,
+                     const char *name2,
+                     V &visitor,
+                     bool in_reverse = false) const  {
+
+        return (const_cast<RingDataFrame *>(this)->single_act_visit<T1, T2, V>
+                    (name1, name2, visitor, in_reverse));
+    }
+
+private:
+
+    struct  ColumnSlot_  {
+
+        ColNameType                 name { };
+        std::type_index             type { typeid(void) };
+        HeteroVector<align_value>   data { };
+
+        // Type-erased helpers, bound to the column type by create_column()
+        //
+        std::function<void(HeteroVector<align_value> &, size_type)>
+            reset_slot { };
+        std::function<void(const RingDataFrame &,
+                           const ColumnSlot_ &,
+                           DataFrameType &)>
+            copy_to { };
+    };
+
+    using ColNameDict =
+        std::unordered_map<ColNameType,
+                           size_type,
+                           std::hash<VirtualString>,
+                           std::equal_to<ColNameType>>;
+
+    inline size_type next_(size_type pos) const noexcept  {
+
+        return (pos + 1 == capacity_ ? 0 : pos + 1);
+    }
+
+    // Physical slot of the i'th row
+    //
+    inline size_type slot_(size_type i) const noexcept  {
+
+        const size_type p = head_ + i;
+
+        return (p < capacity_ ? p : p - capacity_);
+    }
+
+    // It also checks that the column is of type T. A column accessed as
+    // the wrong type would have no buffer of capacity() items
+    //
+    template<typename T>
+    size_type col_index_(const char *name) const  {
+
+        const auto  iter = column_tb_.find (name);
+
+        if (iter == column_tb_.end())  {
+            char buffer [512];
+
+            snprintf (buffer, sizeof(buffer) - 1,
+                      "RingDataFrame: ERROR: Cannot find column '%s'",
+                      name);
+            throw ColNotFound (buffer);
+        }
+        if (data_[iter->second].type != std::type_index(typeid(T)))  {
+            char buffer [512];
+
+            snprintf (buffer, sizeof(buffer) - 1,
+                      "RingDataFrame: ERROR: Column '%s' is not of type %s",
+                      name, typeid(T).name());
+            throw DataFrameError (buffer);
+        }
+        return (iter->second);
+    }
+
+    size_type                   capacity_;
+    size_type                   head_ { 0 };  // Physical slot of oldest row
+    size_type                   size_ { 0 };
+    ColumnVecType<IndexType>    indices_;
+    std::vector<ColumnSlot_>    data_ { };
+    ColNameDict                 column_tb_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -0,0 +1,305 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/Utils/ThreadGranularity.h>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// Series that are derived from one column and recomputed by many visitors
+//
+enum class derived_series : unsigned char  {
+    rolling_mean = 1,   // Simple moving mean. param1 is the period
+    rolling_std = 2,    // Moving std. param1 is the period, param2 is bias
+    ewm_span_mean = 3,  // EWM with span decay. param1 is the span,
+                        // param2 is finite_adjust
+};
+
+// ----------------------------------------------------------------------------
+
+// An opt-in cache of series derived from the columns of one DataFrame.
+// Entries are keyed by column name, kind of series, parameters, and type.
+// Each column has a version counter that is bumped when the column changes.
+// Bumping a version drops that column's entries.
+//
+// Visitors get to the cache through a Scope. DataFrame installs one, on the
+// visiting thread, for the columns it passes to a visitor.
+//
+struct  DerivedCache  {
+
+    using size_type = std::size_t;
+
+    struct  ScopeColumn  {
+
+        const char  *name { nullptr };
+        const void  *data { nullptr };
+        size_type   size { 0 };
+    };
+
+    // It describes a column of the given name and data for a Scope
+    //
+    template<typename V>
+    static inline ScopeColumn
+    column(const char *name, const V &vec) noexcept  {
+
+        return (ScopeColumn { name,
+                              vec.empty() ? nullptr
+                                          : static_cast<const void *>(&vec[0]),
+                              vec.size() });
+    }
+
+    // It makes the given columns of cache visible to fetch() on the calling
+    // thread, for the lifetime of the scope.
+    //
+    struct  Scope  {
+
+        static constexpr size_type  max_cols = 5;
+
+        inline Scope(DerivedCache *cache,
+                     std::initializer_list<ScopeColumn> cols) noexcept
+            : cache_(cache), prev_(current_)  {
+
+            for (const auto &col : cols)
+                if (col_cnt_ < max_cols)  cols_[col_cnt_++] = col;
+            if (cache_)  current_ = this;
+        }
+
+        // It carries another thread's scope over to the calling thread
+        //
+        inline explicit Scope(const Scope *other) noexcept
+            : prev_(current_)  {
+
+            if (other)  {
+                cache_ = other->cache_;
+                cols_ = other->cols_;
+                col_cnt_ = other->col_cnt_;
+                current_ = this;
+            }
+        }
+        inline ~Scope() noexcept  { if (current_ == this)  current_ = prev_; }
+
+        static inline const Scope *current() noexcept  { return (current_); }
+
+        Scope () = delete;
+        Scope (const Scope &) = delete;
+        Scope &operator = (const Scope &) = delete;
+
+    private:
+
+        friend struct   DerivedCache;
+
+        inline const char *
+        find_column_(const void *data, size_type size) const noexcept  {
+
+            for (size_type i = 0; i < col_cnt_; ++i)
+                if (cols_[i].data == data && cols_[i].size == size)
+                    return (cols_[i].name);
+            return (nullptr);
+        }
+
+        DerivedCache                            *cache_ { nullptr };
+        std::array<ScopeColumn, max_cols>       cols_ { };
+        size_type                               col_cnt_ { 0 };
+        const Scope                             *prev_ { nullptr };
+
+        inline static thread_local const Scope  *current_ { nullptr };
+    };
+
+    // It returns the series kind(param1, param2) of the column that starts
+    // at column_begin. If the column is in the current scope, the series is
+    // looked up in the cache, and computed by compute() and cached only if
+    // it is not there. Otherwise, it is just computed.
+    // R is the type of the series and compute() must return an R.
+    //
+    template<typename R, typename H, typename F>
+    static std::shared_ptr<const R>
+    fetch(const H &column_begin,
+          size_type col_s,
+          derived_series kind,
+          double param1,
+          double param2,
+          F &&compute)  {
+
+        const Scope *scope = Scope::current();
+        const char  *name =
+            scope && col_s > 0
+                ? scope->find_column_(
+                      static_cast<const void *>(&(*column_begin)), col_s)
+                : nullptr;
+
+        if (! name)  return (std::make_shared<const R>(compute()));
+
+        DerivedCache    &cache = *(scope->cache_);
+        const Key       key { name, kind, param1, param2, typeid(R) };
+        SpinGuard       guard (&(cache.lock_));
+        const size_type version = cache.versions_[key.column];
+        const auto      iter = cache.entries_.find(key);
+
+        if (iter != cache.entries_.end() && iter->second.version == version) {
+            cache.hit_cnt_ += 1;
+            return (std::static_pointer_cast<const R>(iter->second.series));
+        }
+        cache.miss_cnt_ += 1;
+        guard.release();
+
+        // Computed outside the lock. It is not cached, if the column changed
+        // in the meantime.
+        //
+        std::shared_ptr<const R>    series =
+            std::make_shared<const R>(compute());
+        const SpinGuard             guard2 (&(cache.lock_));
+
+        if (cache.versions_[key.column] == version)
+            cache.entries_[key] = Entry { series, version };
+        return (series);
+    }
+
+    // It bumps the version of the named column and drops its entries.
+    // If name is nullptr, it does that for all columns.
+    //
+    inline void touch(const char *name)  {
+
+        const SpinGuard guard (&lock_);
+
+        if (name)  {
+            versions_[name] += 1;
+            for (auto iter = entries_.begin(); iter != entries_.end(); )
+                if (iter->first.column == name)
+                    iter = entries_.erase(iter);
+                else
+                    ++iter;
+        }
+        else  {
+            for (auto &ver : versions_)  ver.second += 1;
+            entries_.clear();
+        }
+    }
+
+    inline size_type version(const char *name) const  {
+
+        const SpinGuard guard (&lock_);
+        const auto      iter = versions_.find(name);
+
+        return (iter != versions_.end() ? iter->second : 0);
+    }
+    inline size_type size() const  {
+
+        const SpinGuard guard (&lock_);
+
+        return (entries_.size());
+    }
+    inline size_type hit_count() const  {
+
+        const SpinGuard guard (&lock_);
+
+        return (hit_cnt_);
+    }
+    inline size_type miss_count() const  {
+
+        const SpinGuard guard (&lock_);
+
+        return (miss_cnt_);
+    }
+
+    DerivedCache () = default;
+    DerivedCache (const DerivedCache &) = delete;
+    DerivedCache &operator = (const DerivedCache &) = delete;
+
+private:
+
+    struct  Key  {
+
+        std::string     column;
+        derived_series  kind;
+        double          param1;
+        double          param2;
+        std::type_index type;
+
+        inline bool operator == (const Key &rhs) const  {
+
+            return (column == rhs.column && kind == rhs.kind &&
+                    param1 == rhs.param1 && param2 == rhs.param2 &&
+                    type == rhs.type);
+        }
+    };
+
+    struct  KeyHash  {
+
+        inline std::size_t operator() (const Key &key) const  {
+
+            std::size_t seed = std::hash<std::string>{ }(key.column);
+            const auto  combine = [&seed](std::size_t h) -> void  {
+                seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            };
+
+            combine(std::size_t(key.kind));
+            combine(std::hash<double>{ }(key.param1));
+            combine(std::hash<double>{ }(key.param2));
+            combine(key.type.hash_code());
+            return (seed);
+        }
+    };
+
+    struct  Entry  {
+
+        std::shared_ptr<const void> series { };
+        size_type                   version { 0 };
+    };
+
+    std::unordered_map<Key, Entry, KeyHash>         entries_ { };
+    std::unordered_map<std::string, size_type>      versions_ { };
+    size_type                                       hit_cnt_ { 0 };
+    size_type                                       miss_cnt_ { 0 };
+    mutable SpinLock                                lock_ { };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
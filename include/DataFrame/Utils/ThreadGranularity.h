@@ -32,8 +32,20 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <thread>
 
+#if defined(__linux__)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif // __linux__
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#endif // _MSC_VER
+
 // ----------------------------------------------------------------------------
 
 namespace hmdf
@@ -69,25 +81,47 @@ private:
 
 // ----------------------------------------------------------------------------
 
+// A recursive lock that spins for a short while, and then parks the waiting
+// thread in the kernel (futex on Linux), so a contended lock does not burn
+// whole cores. The spin backs off exponentially and pauses the CPU between
+// tries.
+// It also keeps counters of its cost. See get_stats()
+//
 struct  SpinLock  {
 
+    // The counters are updated with relaxed atomics. So they are cheap, but
+    // only roughly consistent with each other while the lock is in use.
+    //
+    struct  Stats  {
+
+        std::size_t acquisitions { 0 };  // Outermost lock()s and try_lock()s
+        std::size_t contended { 0 };     // Acquisitions that had to wait
+        std::size_t parks { 0 };         // Times a waiter went to sleep
+        std::size_t wait_nanosec { 0 };  // Time spent spinning and parked
+    };
+
     SpinLock () = default;
     ~SpinLock() = default;
 
+    // max_spin: Max number of CPU pauses in one round of spinning, before
+    //           the waiting thread is parked. 0 parks right away
+    //
+    explicit SpinLock (unsigned int max_spin) noexcept
+        : max_spin_(max_spin)  {   }
+
     inline void lock() noexcept {
 
         const std::thread::id   thr_id = std::this_thread::get_id();
 
-        if (thr_id != owner_)  {
-#ifdef __cpp_lib_atomic_flag_test
-            while (true) {
-                if (! lock_.test_and_set(std::memory_order_acquire)) break;
-                while (lock_.test(std::memory_order_relaxed)) ;
-            }
-#else
-            while (lock_.test_and_set(std::memory_order_acquire)) ;
-#endif // __cpp_lib_atomic_flag_test
-            owner_ = thr_id;
+        if (thr_id != owner_.load(std::memory_order_relaxed))  {
+            int expected = unlocked_;
+
+            if (! state_.compare_exchange_strong(expected, locked_,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed))
+                lock_contended_();
+            acquisitions_.fetch_add(1, std::memory_order_relaxed);
+            owner_.store(thr_id, std::memory_order_relaxed);
         }
 
         count_ += 1;
@@ -96,38 +130,153 @@ struct  SpinLock  {
 
         const std::thread::id   thr_id = std::this_thread::get_id();
 
-        if (thr_id == owner_ ||
-            ! lock_.test_and_set(std::memory_order_acquire))  {
-            owner_ = thr_id;
+        if (thr_id == owner_.load(std::memory_order_relaxed))  {
             count_ += 1;
+            return (true);
         }
 
-        return (thr_id == owner_);
+        int expected = unlocked_;
+
+        if (state_.compare_exchange_strong(expected, locked_,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed))  {
+            acquisitions_.fetch_add(1, std::memory_order_relaxed);
+            owner_.store(thr_id, std::memory_order_relaxed);
+            count_ += 1;
+            return (true);
+        }
+        return (false);
     }
     inline void unlock() noexcept {
 
         const std::thread::id   thr_id = std::this_thread::get_id();
 
-        if (thr_id == owner_)  {
+        if (thr_id == owner_.load(std::memory_order_relaxed))  {
             count_ -= 1;
 
             assert(count_ >= 0);
             if (count_ == 0)  {
-                owner_ = std::thread::id { };
-                lock_.clear(std::memory_order_release);
+                owner_.store(std::thread::id { }, std::memory_order_relaxed);
+                if (state_.exchange(unlocked_, std::memory_order_release) ==
+                        parked_)
+                    unpark_one_();
             }
         }
         else  assert(0);
     }
 
+    inline Stats get_stats() const noexcept  {
+
+        return (Stats { acquisitions_.load(std::memory_order_relaxed),
+                        contended_.load(std::memory_order_relaxed),
+                        parks_.load(std::memory_order_relaxed),
+                        wait_nanosec_.load(std::memory_order_relaxed) });
+    }
+    inline void reset_stats() noexcept  {
+
+        acquisitions_.store(0, std::memory_order_relaxed);
+        contended_.store(0, std::memory_order_relaxed);
+        parks_.store(0, std::memory_order_relaxed);
+        wait_nanosec_.store(0, std::memory_order_relaxed);
+    }
+
     SpinLock (const SpinLock &) = delete;
     SpinLock &operator = (const SpinLock &) = delete;
 
 private:
 
-    std::atomic_flag    lock_ = ATOMIC_FLAG_INIT;
-    std::thread::id     owner_ { };
-    int                 count_ { 0 };
+    // The states of the lock. parked_ means the lock is held and there may
+    // be threads asleep waiting for it, so unlock() must wake one up
+    //
+    static constexpr int    unlocked_ { 0 };
+    static constexpr int    locked_ { 1 };
+    static constexpr int    parked_ { 2 };
+
+    inline void lock_contended_() noexcept  {
+
+        const auto  start = std::chrono::steady_clock::now();
+        bool        acquired = false;
+
+        contended_.fetch_add(1, std::memory_order_relaxed);
+
+        // Spin with exponential backoff, reading before trying to write
+        //
+        for (unsigned int spins = 1; spins <= max_spin_ && ! acquired;
+             spins *= 2)  {
+            for (unsigned int i = 0; i < spins; ++i)  cpu_relax_();
+
+            int expected = unlocked_;
+
+            acquired =
+                state_.load(std::memory_order_relaxed) == unlocked_ &&
+                state_.compare_exchange_weak(expected, locked_,
+                                             std::memory_order_acquire,
+                                             std::memory_order_relaxed);
+        }
+
+        // Park. Whoever gets the lock this way leaves it as parked_, since
+        // there may be other sleepers
+        //
+        if (! acquired)
+            while (state_.exchange(parked_, std::memory_order_acquire) !=
+                       unlocked_)  {
+                parks_.fetch_add(1, std::memory_order_relaxed);
+                park_();
+            }
+
+        wait_nanosec_.fetch_add(
+            std::size_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count()),
+            std::memory_order_relaxed);
+    }
+
+    static inline void cpu_relax_() noexcept  {
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#elif defined(__GNUC__) && (defined(__aarch64__) || defined(__arm__))
+        asm volatile ("yield" ::: "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif // _MSC_VER
+    }
+
+    // It sleeps while the lock is parked_. It may return spuriously
+    //
+    inline void park_() noexcept  {
+
+#if defined(__linux__)
+        static_assert(sizeof(state_) == sizeof(int),
+                      "futex needs a plain int");
+        ::syscall(SYS_futex, reinterpret_cast<int *>(&state_),
+                  FUTEX_WAIT_PRIVATE, parked_, nullptr, nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+        state_.wait(parked_, std::memory_order_relaxed);
+#else
+        std::this_thread::yield();
+#endif // __linux__
+    }
+    inline void unpark_one_() noexcept  {
+
+#if defined(__linux__)
+        ::syscall(SYS_futex, reinterpret_cast<int *>(&state_),
+                  FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(__cpp_lib_atomic_wait)
+        state_.notify_one();
+#endif // __linux__
+    }
+
+    std::atomic<int>                state_ { unlocked_ };
+    std::atomic<std::thread::id>    owner_ { };
+    int                             count_ { 0 };  // Only owner touches it
+    const unsigned int              max_spin_ { 1024 };
+
+    std::atomic<std::size_t>    acquisitions_ { 0 };
+    std::atomic<std::size_t>    contended_ { 0 };
+    std::atomic<std::size_t>    parks_ { 0 };
+    std::atomic<std::size_t>    wait_nanosec_ { 0 };
 };
 
 // ----------------------------------------------------------------------------
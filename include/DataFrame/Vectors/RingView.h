@@ -0,0 +1,363 @@
+// Hossein Moein
+// October 18, 2026
+/*
+Copyright (c) 2019-2026, Hossein Moein
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+* Neither the name of Hossein Moein and/or the DataFrame nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL Hossein Moein BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include <DataFrame/Vectors/VectorView.h>
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace hmdf
+{
+
+// This is a view that would make a circular buffer of continuous memory
+// look like an STL vector. The buffer has a fixed capacity and the first
+// item of the view is at head. The items wrap around from the end of the
+// buffer to its beginning.
+// It also gives you STL conformant random access iterators, so the view
+// can be passed to visitors and algorithms as if it was linear.
+//
+template<typename T>
+class RingView {
+
+public:
+
+    using value_type = T;
+    using size_type = unsigned long long int;
+    using pointer = value_type *;
+    using const_pointer = const value_type *;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    // The two continuous segments of the view. The second one is empty,
+    // if the view does not wrap around
+    //
+    using SegmentPair =
+        std::pair<VectorView<value_type>, VectorView<value_type>>;
+
+    RingView() = default;
+    RingView(const RingView &) = default;
+    RingView(RingView &&) = default;
+    RingView &operator= (const RingView &) = default;
+    RingView &operator= (RingView &&) = default;
+    ~RingView() = default;
+
+    // buffer: Beginning of the circular buffer
+    // buf_capacity: Number of items in the circular buffer
+    // head: Position of the first item of the view in the buffer
+    // sz: Number of items in the view
+    //
+    inline RingView (value_type *buffer,
+                     size_type buf_capacity,
+                     size_type head,
+                     size_type sz) noexcept
+        : buffer_(buffer), buf_capacity_(buf_capacity),
+          head_(head), size_(sz)  {   }
+
+    inline bool empty () const noexcept  { return (size_ == 0); }
+    inline size_type size () const noexcept  { return (size_); }
+    inline size_type capacity () const noexcept  { return (buf_capacity_); }
+    inline void clear () noexcept  { size_ = 0; }
+
+    inline reference at (size_type i) noexcept  { return (*slot_(i)); }
+    inline const_reference
+    at (size_type i) const noexcept  { return (*slot_(i)); }
+    inline reference operator [] (size_type i) noexcept  {
+
+        return (*slot_(i));
+    }
+    inline const_reference operator [] (size_type i) const noexcept  {
+
+        return (*slot_(i));
+    }
+    inline reference front() noexcept  { return (*slot_(0)); }
+    inline const_reference front() const noexcept  { return (*slot_(0)); }
+    inline reference back() noexcept  { return (*slot_(size_ - 1)); }
+    inline const_reference
+    back() const noexcept  { return (*slot_(size_ - 1)); }
+
+    // It returns the view as two continuous segments, in order. Loops that
+    // want raw pointers (e.g. to vectorize) can run over each segment.
+    //
+    inline SegmentPair segments () const noexcept  {
+
+        SegmentPair     ret;
+
+        if (size_ == 0)  return (ret);
+
+        const size_type first_s = std::min(size_, buf_capacity_ - head_);
+
+        ret.first = VectorView<value_type>(buffer_ + head_,
+                                           buffer_ + head_ + first_s);
+        if (first_s < size_)
+            ret.second = VectorView<value_type>(buffer_,
+                                                buffer_ + (size_ - first_s));
+        return (ret);
+    }
+
+    inline bool is_wrapped () const noexcept  {
+
+        return (head_ + size_ > buf_capacity_);
+    }
+
+    // These are to match the std::vector interface, so things will compile
+    //
+    inline void shrink_to_fit()  {  }
+    inline void reserve (size_type)  {  }
+
+    inline void swap (RingView &rhs) noexcept  {
+
+        std::swap (buffer_, rhs.buffer_);
+        std::swap (buf_capacity_, rhs.buf_capacity_);
+        std::swap (head_, rhs.head_);
+        std::swap (size_, rhs.size_);
+        return;
+    }
+
+public:
+
+    // This iterator contains the buffer and a position relative to head.
+    // Dereferencing it wraps the position around the buffer. It is cheap
+    // to create and copy around.
+    // P is either value_type or const value_type
+    //
+    template<typename P>
+    class   ring_iterator  {
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = typename std::remove_const<P>::type;
+        using pointer = P *;
+        using reference = P &;
+        using difference_type = long;
+
+    public:
+
+        inline ring_iterator () = default;
+
+        inline ring_iterator (P *buffer,
+                              difference_type buf_capacity,
+                              difference_type head,
+                              difference_type pos) noexcept
+            : buffer_ (buffer), buf_capacity_ (buf_capacity),
+              head_ (head), pos_ (pos)  {   }
+
+        // An iterator converts to a const_iterator
+        //
+        template<typename Q,
+                 typename = typename std::enable_if<
+                     std::is_same<const Q, P>::value>::type>
+        inline ring_iterator (const ring_iterator<Q> &that) noexcept
+            : buffer_ (that.buffer_), buf_capacity_ (that.buf_capacity_),
+              head_ (that.head_), pos_ (that.pos_)  {   }
+
+        inline bool operator == (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ == rhs.pos_);
+        }
+        inline bool operator != (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ != rhs.pos_);
+        }
+        inline bool operator < (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ < rhs.pos_);
+        }
+        inline bool operator > (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ > rhs.pos_);
+        }
+        inline bool operator <= (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ <= rhs.pos_);
+        }
+        inline bool operator >= (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ >= rhs.pos_);
+        }
+
+       // Following STL style, this iterator appears as a pointer
+       // to value_type.
+       //
+        inline pointer operator -> () const noexcept  { return (slot_(pos_)); }
+        inline reference operator * () const noexcept  {
+
+            return (*slot_(pos_));
+        }
+        inline reference operator [] (difference_type i) const noexcept  {
+
+            return (*slot_(pos_ + i));
+        }
+
+        inline ring_iterator &operator ++ () noexcept  {    // ++Prefix
+
+            pos_ += 1;
+            return (*this);
+        }
+        inline ring_iterator operator ++ (int) noexcept  {  // Postfix++
+
+            ring_iterator   ret = *this;
+
+            pos_ += 1;
+            return (ret);
+        }
+        inline ring_iterator &operator -- () noexcept  {    // --Prefix
+
+            pos_ -= 1;
+            return (*this);
+        }
+        inline ring_iterator operator -- (int) noexcept  {  // Postfix--
+
+            ring_iterator   ret = *this;
+
+            pos_ -= 1;
+            return (ret);
+        }
+
+        inline ring_iterator &operator += (difference_type step) noexcept  {
+
+            pos_ += step;
+            return (*this);
+        }
+        inline ring_iterator &operator -= (difference_type step) noexcept  {
+
+            pos_ -= step;
+            return (*this);
+        }
+        inline ring_iterator
+        operator + (difference_type step) const noexcept  {
+
+            ring_iterator   ret = *this;
+
+            ret.pos_ += step;
+            return (ret);
+        }
+        inline ring_iterator
+        operator - (difference_type step) const noexcept  {
+
+            ring_iterator   ret = *this;
+
+            ret.pos_ -= step;
+            return (ret);
+        }
+        inline difference_type
+        operator - (const ring_iterator &rhs) const noexcept  {
+
+            return (pos_ - rhs.pos_);
+        }
+
+        friend inline ring_iterator
+        operator + (difference_type step, const ring_iterator &rhs) noexcept {
+
+            return (rhs + step);
+        }
+
+    private:
+
+        // Position relative to head is always in [0, capacity), so
+        // wrapping around takes one compare and no division
+        //
+        inline pointer slot_ (difference_type pos) const noexcept  {
+
+            const difference_type   p = head_ + pos;
+
+            return (buffer_ + (p < buf_capacity_ ? p : p - buf_capacity_));
+        }
+
+        P               *buffer_ { nullptr };
+        difference_type buf_capacity_ { 0 };
+        difference_type head_ { 0 };
+        difference_type pos_ { 0 };
+
+        template<typename Q>
+        friend class    ring_iterator;
+    };
+
+    using iterator = ring_iterator<value_type>;
+    using const_iterator = ring_iterator<const value_type>;
+
+    inline iterator begin () noexcept  { return (make_iter_<iterator>(0)); }
+    inline iterator end () noexcept  { return (make_iter_<iterator>(size_)); }
+    inline const_iterator begin () const noexcept  {
+
+        return (make_iter_<const_iterator>(0));
+    }
+    inline const_iterator end () const noexcept  {
+
+        return (make_iter_<const_iterator>(size_));
+    }
+
+    inline std::reverse_iterator<iterator>
+    rbegin() noexcept { return (std::make_reverse_iterator(end())); }
+    inline std::reverse_iterator<iterator>
+    rend() noexcept { return (std::make_reverse_iterator(begin())); }
+    inline std::reverse_iterator<const_iterator>
+    rbegin() const noexcept { return (std::make_reverse_iterator(end())); }
+    inline std::reverse_iterator<const_iterator>
+    rend() const noexcept { return (std::make_reverse_iterator(begin())); }
+
+private:
+
+    inline pointer slot_ (size_type i) const noexcept  {
+
+        const size_type p = head_ + i;
+
+        return (buffer_ + (p < buf_capacity_ ? p : p - buf_capacity_));
+    }
+
+    template<typename ITR>
+    inline ITR make_iter_ (size_type pos) const noexcept  {
+
+        return (ITR(buffer_,
+                    long(buf_capacity_),
+                    long(head_),
+                    long(pos)));
+    }
+
+    value_type  *buffer_ { nullptr };
+    size_type   buf_capacity_ { 0 };
+    size_type   head_ { 0 };
+    size_type   size_ { 0 };
+};
+
+} // namespace hmdf
+
+// ----------------------------------------------------------------------------
+
+// Local Variables:
+// mode:C++
+// tab-width:4
+// c-basic-offset:4
+// End:
@@ -29,11 +29,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <DataFrame/DataFrameMLVisitors.h>
 #include <DataFrame/DataFrameStatsVisitors.h>
 #include <DataFrame/DataFrameTransformVisitors.h>
+#include <DataFrame/LiveDataFrame.h>
 #include <DataFrame/RandGen.h>
+#include <DataFrame/RingDataFrame.h>
 
+#include <atomic>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
 
 using namespace hmdf;
 
@@ -1408,6 +1413,2501 @@ static void test_LinregMovingMeanVisitor()  {
 
 // -----------------------------------------------------------------------------
 
+static void test_groupby_sorted()  {
+
+    std::cout << "\nTesting groupby_sorted( ) ..." << std::endl;
+
+    MyDataFrame                df;
+    StlVecType<unsigned long>  idxvec =
+        { 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL, 8UL, 9UL, 10UL, 11UL, 12UL };
+    StlVecType<int>            sorted_key =
+        { 1, 1, 1, 2, 2, 3, 4, 4, 4, 4, 5, 6 };
+    StlVecType<int>            clustered_key =
+        { 9, 9, 9, 2, 2, 7, 1, 1, 1, 1, 8, 3 };
+    StlVecType<double>         dblvec =
+        { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0 };
+
+    df.load_data(std::move(idxvec),
+                 std::make_pair("sorted_key", sorted_key),
+                 std::make_pair("clustered_key", clustered_key),
+                 std::make_pair("dbl_col", dblvec));
+
+    const auto  result1 =
+        df.groupby1<int>(
+            "sorted_key",
+            LastVisitor<MyDataFrame::IndexType, MyDataFrame::IndexType>(),
+            std::make_tuple("dbl_col", "sum_dbl", SumVisitor<double>()),
+            std::make_tuple("dbl_col", "cnt_dbl", CountVisitor<double>()));
+
+    assert(result1.get_index().size() == 6);
+    assert((result1.get_index() ==
+            StlVecType<unsigned long> { 3, 5, 6, 10, 11, 12 }));
+    assert((result1.get_column<int>("sorted_key") ==
+            StlVecType<int> { 1, 2, 3, 4, 5, 6 }));
+    assert((result1.get_column<double>("sum_dbl") ==
+            StlVecType<double> { 6, 9, 6, 34, 11, 12 }));
+    assert((result1.get_column<std::size_t>("cnt_dbl") ==
+            StlVecType<std::size_t> { 3, 2, 1, 4, 1, 1 }));
+
+    // Runs keep their order of appearance
+    //
+    const auto  result2 =
+        df.groupby1_clustered<int>(
+            "clustered_key",
+            FirstVisitor<MyDataFrame::IndexType, MyDataFrame::IndexType>(),
+            std::make_tuple("dbl_col", "sum_dbl", SumVisitor<double>()));
+
+    assert((result2.get_index() ==
+            StlVecType<unsigned long> { 1, 4, 6, 7, 11, 12 }));
+    assert((result2.get_column<int>("clustered_key") ==
+            StlVecType<int> { 9, 2, 7, 1, 8, 3 }));
+    assert((result2.get_column<double>("sum_dbl") ==
+            StlVecType<double> { 6, 9, 6, 34, 11, 12 }));
+
+    // The sorting path must produce the same groups for the clustered key
+    //
+    const auto  result3 =
+        df.groupby1<int>(
+            "clustered_key",
+            FirstVisitor<MyDataFrame::IndexType, MyDataFrame::IndexType>(),
+            std::make_tuple("dbl_col", "sum_dbl", SumVisitor<double>()));
+
+    assert((result3.get_column<int>("clustered_key") ==
+            StlVecType<int> { 1, 2, 3, 7, 8, 9 }));
+    assert((result3.get_column<double>("sum_dbl") ==
+            StlVecType<double> { 34, 9, 12, 6, 11, 6 }));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_groupby_parallel()  {
+
+    std::cout << "\nTesting groupby_parallel( ) ..." << std::endl;
+
+    MyDataFrame                 df;
+    StlVecType<unsigned long>   idxvec(10000);
+    StlVecType<int>             keyvec(10000);
+    StlVecType<double>          dblvec(10000);
+    StlVecType<std::string>     strvec(10000);
+
+    for (std::size_t i = 0; i < idxvec.size(); ++i)  {
+        idxvec[i] = i;
+        keyvec[i] = int((i * 7919) % 97);
+        dblvec[i] = double(i % 113) * 0.5;
+        strvec[i] = std::to_string(i % 5);
+    }
+    df.load_data(std::move(idxvec),
+                 std::make_pair("key", keyvec),
+                 std::make_pair("str_key", strvec),
+                 std::make_pair("dbl_col", dblvec));
+
+    auto    run_groupby = [&df]() -> MyDataFrame  {
+        return (df.groupby2<int, std::string>(
+                    "key", "str_key",
+                    LastVisitor<MyDataFrame::IndexType,
+                                MyDataFrame::IndexType>(),
+                    std::make_tuple("dbl_col", "sum", SumVisitor<double>()),
+                    std::make_tuple("dbl_col", "max", MaxVisitor<double>()),
+                    std::make_tuple("dbl_col", "min", MinVisitor<double>()),
+                    std::make_tuple("dbl_col", "mean", MeanVisitor<double>()),
+                    std::make_tuple("dbl_col", "cnt", CountVisitor<double>()),
+                    std::make_tuple("key", "key_sum", SumVisitor<int>())));
+    };
+
+    const auto  serial_res = run_groupby();
+
+    ThreadGranularity::set_thread_level(4);
+
+    const auto  parallel_res = run_groupby();
+
+    ThreadGranularity::set_thread_level(0);
+
+    assert(serial_res.get_index().size() == 485);
+    assert((serial_res.is_equal<int, double, std::size_t, std::string>
+                (parallel_res)));
+
+    // Aggregation visitors may call DataFrame methods that take the lock
+    //
+    struct  LockingSumVisitor : public SumVisitor<double>  {
+
+        explicit LockingSumVisitor(const MyDataFrame &d) : df(&d)  {   }
+
+        void pre()  {
+
+            SumVisitor<double>::pre();
+            assert(! df->get_column<double>("dbl_col").empty());
+        }
+
+        const MyDataFrame   *df;
+    };
+
+    SpinLock    lock;
+
+    MyDataFrame::set_lock(&lock);
+    ThreadGranularity::set_thread_level(4);
+
+    const auto  locking_res =
+        df.groupby1<int>(
+            "key",
+            LastVisitor<MyDataFrame::IndexType, MyDataFrame::IndexType>(),
+            std::make_tuple("dbl_col", "sum1", LockingSumVisitor(df)),
+            std::make_tuple("dbl_col", "sum2", LockingSumVisitor(df)),
+            std::make_tuple("dbl_col", "sum3", LockingSumVisitor(df)));
+
+    ThreadGranularity::set_thread_level(0);
+    MyDataFrame::remove_lock();
+
+    assert(locking_res.get_index().size() == 97);
+    assert(locking_res.get_column<double>("sum1") ==
+           locking_res.get_column<double>("sum3"));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_hash_join()  {
+
+    std::cout << "\nTesting hash_join( ) ..." << std::endl;
+
+    MyDataFrame lhs_df;
+    MyDataFrame rhs_df;
+
+    lhs_df.load_data(
+        StlVecType<unsigned long> { 5, 3, 1, 3, 7 },
+        std::make_pair("lcol", StlVecType<double> { 0, 1, 2, 3, 4 }));
+    rhs_df.load_data(
+        StlVecType<unsigned long> { 3, 9, 5, 3, 3 },
+        std::make_pair("rcol", StlVecType<double> { 10, 11, 12, 13, 14 }));
+
+    auto    inner_res =
+        lhs_df.join_by_index<MyDataFrame, double>
+            (rhs_df, join_policy::inner_join, join_algorithm::hash);
+
+    assert((inner_res.get_index() == StlVecType<unsigned long> { 5, 3, 3 }));
+    assert((inner_res.get_column<double>("lcol") ==
+            StlVecType<double> { 0, 1, 3 }));
+    assert((inner_res.get_column<double>("rcol") ==
+            StlVecType<double> { 12, 10, 13 }));
+
+    auto    right_res =
+        lhs_df.join_by_index<MyDataFrame, double>
+            (rhs_df, join_policy::right_join, join_algorithm::hash);
+
+    assert((right_res.get_index() ==
+            StlVecType<unsigned long> { 3, 9, 5, 3, 3 }));
+    assert(right_res.get_column<double>("lcol")[0] == 1);
+    assert(std::isnan(right_res.get_column<double>("lcol")[1]));
+    assert(right_res.get_column<double>("lcol")[3] == 3);
+    assert(std::isnan(right_res.get_column<double>("lcol")[4]));
+
+    auto    merge_res =
+        lhs_df.join_by_index<MyDataFrame, double>
+            (rhs_df, join_policy::left_right_join, join_algorithm::hash);
+
+    assert((merge_res.get_index() ==
+            StlVecType<unsigned long> { 5, 3, 1, 3, 7, 9, 3 }));
+    assert(merge_res.get_column<double>("lcol")[4] == 4);
+    assert(std::isnan(merge_res.get_column<double>("lcol")[5]));
+    assert(std::isnan(merge_res.get_column<double>("rcol")[2]));
+    assert(merge_res.get_column<double>("rcol")[6] == 14);
+
+    // Large enough to be partitioned. Both algorithms must join the same
+    // rows. Sort-merge returns them in key order.
+    //
+    constexpr std::size_t       lhs_s = 50000;
+    constexpr std::size_t       rhs_s = 30000;
+    MyDataFrame                 big_lhs;
+    MyDataFrame                 big_rhs;
+    StlVecType<int>             lhs_keys(lhs_s);
+    StlVecType<int>             rhs_keys(rhs_s);
+    StlVecType<double>          lhs_vals(lhs_s);
+    StlVecType<double>          rhs_vals(rhs_s);
+
+    for (std::size_t i = 0; i < lhs_s; ++i)  {
+        lhs_keys[i] = int((i * 7919) % lhs_s);
+        lhs_vals[i] = double(i);
+    }
+    for (std::size_t i = 0; i < rhs_s; ++i)  {
+        rhs_keys[i] = int((i * 104729) % rhs_s) * 2;
+        rhs_vals[i] = double(i) + 0.5;
+    }
+    big_lhs.load_data(MyDataFrame::gen_sequence_index(0, lhs_s, 1),
+                      std::make_pair("key", lhs_keys),
+                      std::make_pair("lval", lhs_vals));
+    big_rhs.load_data(MyDataFrame::gen_sequence_index(0, rhs_s, 1),
+                      std::make_pair("key", rhs_keys),
+                      std::make_pair("rval", rhs_vals));
+
+    for (const unsigned int thread_level : { 0, 4 })  {
+        ThreadGranularity::set_thread_level(thread_level);
+        for (const auto jp : { join_policy::inner_join,
+                               join_policy::left_join,
+                               join_policy::right_join,
+                               join_policy::left_right_join })  {
+            const auto  sort_res =
+                big_lhs.join_by_column<MyDataFrame, int, double>
+                    (big_rhs, "key", jp);
+            auto        hash_res =
+                big_lhs.join_by_column<MyDataFrame, int, double>
+                    (big_rhs, "key", jp, join_algorithm::hash);
+
+            assert(hash_res.get_index().size() ==
+                   sort_res.get_index().size());
+            hash_res.sort<int, unsigned long, int, double>
+                ("key", sort_spec::ascen);
+            assert(hash_res.get_column<int>("key") ==
+                   sort_res.get_column<int>("key"));
+            assert(hash_res.get_column<unsigned long>("lhs.INDEX") ==
+                   sort_res.get_column<unsigned long>("lhs.INDEX"));
+            assert(hash_res.get_column<unsigned long>("rhs.INDEX") ==
+                   sort_res.get_column<unsigned long>("rhs.INDEX"));
+        }
+    }
+    ThreadGranularity::set_thread_level(0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_sorted_join()  {
+
+    std::cout << "\nTesting sorted_join( ) ..." << std::endl;
+
+    constexpr std::size_t       lhs_s = 20000;
+    constexpr std::size_t       rhs_s = 15000;
+    StlVecType<unsigned long>   lhs_idx(lhs_s);
+    StlVecType<unsigned long>   rhs_idx(rhs_s);
+    StlVecType<double>          lhs_dbl(lhs_s);
+    StlVecType<double>          rhs_dbl(rhs_s);
+    StlVecType<int>             lhs_int(lhs_s);
+    StlVecType<std::string>     rhs_str(rhs_s);
+
+    for (std::size_t i = 0; i < lhs_s; ++i)  {
+        lhs_idx[i] = i * 2;
+        lhs_dbl[i] = double(i) * 0.25;
+        lhs_int[i] = int(i % 31);
+    }
+    for (std::size_t i = 0; i < rhs_s; ++i)  {
+        rhs_idx[i] = i * 3;
+        rhs_dbl[i] = double(i) * 1.5;
+        rhs_str[i] = std::to_string(i % 17);
+    }
+
+    MyDataFrame sorted_lhs;
+    MyDataFrame sorted_rhs;
+    MyDataFrame unsorted_lhs;
+    MyDataFrame unsorted_rhs;
+
+    sorted_lhs.load_data(StlVecType<unsigned long>(lhs_idx),
+                         std::make_pair("dbl_col", lhs_dbl),
+                         std::make_pair("int_col", lhs_int));
+    sorted_rhs.load_data(StlVecType<unsigned long>(rhs_idx),
+                         std::make_pair("dbl_col", rhs_dbl),
+                         std::make_pair("str_col", rhs_str));
+
+    // Same data in reverse order, so it goes through the sorting merge
+    //
+    std::reverse(lhs_idx.begin(), lhs_idx.end());
+    std::reverse(lhs_dbl.begin(), lhs_dbl.end());
+    std::reverse(lhs_int.begin(), lhs_int.end());
+    std::reverse(rhs_idx.begin(), rhs_idx.end());
+    std::reverse(rhs_dbl.begin(), rhs_dbl.end());
+    std::reverse(rhs_str.begin(), rhs_str.end());
+    unsorted_lhs.load_data(std::move(lhs_idx),
+                           std::make_pair("dbl_col", lhs_dbl),
+                           std::make_pair("int_col", lhs_int));
+    unsorted_rhs.load_data(std::move(rhs_idx),
+                           std::make_pair("dbl_col", rhs_dbl),
+                           std::make_pair("str_col", rhs_str));
+
+    for (const auto jp : { join_policy::inner_join,
+                           join_policy::left_join,
+                           join_policy::right_join,
+                           join_policy::left_right_join })  {
+        const auto  unsorted_res =
+            unsorted_lhs.join_by_index<MyDataFrame, double, int, std::string>
+                (unsorted_rhs, jp);
+
+        ThreadGranularity::set_thread_level(4);
+
+        const auto  sorted_res =
+            sorted_lhs.join_by_index<MyDataFrame, double, int, std::string>
+                (sorted_rhs, jp);
+
+        ThreadGranularity::set_thread_level(0);
+
+        assert(sorted_res.get_index() == unsorted_res.get_index());
+        assert((sorted_res.get_column<int>("int_col") ==
+                unsorted_res.get_column<int>("int_col")));
+        assert((sorted_res.get_column<std::string>("str_col") ==
+                unsorted_res.get_column<std::string>("str_col")));
+
+        const auto  &lhs_dbl_res = sorted_res.get_column<double>("lhs.dbl_col");
+        const auto  &rhs_dbl_res = sorted_res.get_column<double>("rhs.dbl_col");
+
+        for (std::size_t i = 0; i < sorted_res.get_index().size(); ++i)  {
+            const unsigned long idx = sorted_res.get_index()[i];
+
+            if (idx % 2 == 0 && idx / 2 < lhs_s)
+                assert(lhs_dbl_res[i] == double(idx / 2) * 0.25);
+            else
+                assert(std::isnan(lhs_dbl_res[i]));
+            if (idx % 3 == 0 && idx / 3 < rhs_s)
+                assert(rhs_dbl_res[i] == double(idx / 3) * 1.5);
+            else
+                assert(std::isnan(rhs_dbl_res[i]));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_join_asof()  {
+
+    std::cout << "\nTesting join_asof( ) ..." << std::endl;
+
+    MyDataFrame trades;
+    MyDataFrame quotes;
+
+    trades.load_data(
+        StlVecType<unsigned long> { 2, 5, 5, 9, 14, 20 },
+        std::make_pair("sym", StlVecType<std::string> {
+            "IBM", "AAPL", "IBM", "AAPL", "IBM", "MSFT" }),
+        std::make_pair("price", StlVecType<double> {
+            100.1, 200.2, 100.3, 200.4, 100.5, 300.6 }));
+    quotes.load_data(
+        StlVecType<unsigned long> { 1, 3, 5, 8, 10, 15 },
+        std::make_pair("sym", StlVecType<std::string> {
+            "IBM", "AAPL", "IBM", "IBM", "AAPL", "IBM" }),
+        std::make_pair("bid", StlVecType<double> {
+            10.0, 20.0, 11.0, 12.0, 21.0, 13.0 }));
+
+    const auto  backward =
+        trades.join_asof<MyDataFrame, double, std::string>(quotes);
+    const auto  &b_bid = backward.get_column<double>("bid");
+
+    assert((backward.get_index() ==
+            StlVecType<unsigned long> { 2, 5, 5, 9, 14, 20 }));
+    assert((b_bid == StlVecType<double> { 10, 11, 11, 12, 21, 13 }));
+    assert(backward.get_column<double>("price")[4] == 100.5);
+    assert(backward.get_column<std::string>("lhs.sym")[1] == "AAPL");
+    assert(backward.get_column<std::string>("rhs.sym")[1] == "IBM");
+
+    const auto  forward =
+        trades.join_asof<MyDataFrame, double, std::string>
+            (quotes, asof_policy::forward);
+    const auto  &f_bid = forward.get_column<double>("bid");
+
+    assert(f_bid[0] == 20 && f_bid[1] == 11 && f_bid[3] == 21);
+    assert(f_bid[4] == 13 && std::isnan(f_bid[5]));
+
+    const auto  nearest =
+        trades.join_asof<MyDataFrame, double, std::string>
+            (quotes, asof_policy::nearest, 2);
+    const auto  &n_bid = nearest.get_column<double>("bid");
+
+    assert(n_bid[0] == 10 && n_bid[3] == 12 && n_bid[4] == 13);
+    assert(std::isnan(n_bid[5]));
+
+    const auto  by_sym =
+        trades.join_asof<MyDataFrame, std::string, double, std::string>
+            (quotes, "sym");
+    const auto  &s_bid = by_sym.get_column<double>("bid");
+
+    assert((by_sym.get_column<std::string>("sym") ==
+            StlVecType<std::string> {
+                "IBM", "AAPL", "IBM", "AAPL", "IBM", "MSFT" }));
+    assert(s_bid[0] == 10 && s_bid[1] == 20 && s_bid[2] == 11);
+    assert(s_bid[3] == 20 && s_bid[4] == 12 && std::isnan(s_bid[5]));
+
+    const auto  by_sym_tol =
+        trades.join_asof<MyDataFrame, std::string, double, std::string>
+            (quotes, "sym", asof_policy::backward, 3);
+
+    assert(std::isnan(by_sym_tol.get_column<double>("bid")[3]));
+    assert(by_sym_tol.get_column<double>("bid")[2] == 11);
+
+    // An index without a distance works for backward and forward only
+    //
+    using StrDataFrame = StdDataFrame256<std::string>;
+
+    StrDataFrame    str_lhs;
+    StrDataFrame    str_rhs;
+
+    str_lhs.load_data(StlVecType<std::string> { "b", "d", "f" },
+                      std::make_pair("lhs_col",
+                                     StlVecType<double> { 1, 2, 3 }));
+    str_rhs.load_data(StlVecType<std::string> { "a", "c", "e" },
+                      std::make_pair("rhs_col",
+                                     StlVecType<double> { 10, 20, 30 }));
+
+    const auto  str_back = str_lhs.join_asof<StrDataFrame, double>(str_rhs);
+    const auto  str_fwd =
+        str_lhs.join_asof<StrDataFrame, double>(str_rhs,
+                                                asof_policy::forward);
+
+    assert((str_back.get_column<double>("rhs_col") ==
+            StlVecType<double> { 10, 20, 30 }));
+    assert(str_fwd.get_column<double>("rhs_col")[1] == 30);
+    assert(std::isnan(str_fwd.get_column<double>("rhs_col")[2]));
+    try  {
+        [[maybe_unused]] const auto res =
+            str_lhs.join_asof<StrDataFrame, double>(str_rhs,
+                                                    asof_policy::nearest);
+        assert(false);
+    }
+    catch (const NotFeasible &)  {  }
+
+    try  {
+        quotes.get_index()[0] = 100;
+        [[maybe_unused]] const auto res =
+            trades.join_asof<MyDataFrame, double, std::string>(quotes);
+        assert(false);
+    }
+    catch (const NotFeasible &)  {  }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_multi_column_join()  {
+
+    std::cout << "\nTesting multi_column_join( ) ..." << std::endl;
+
+    MyDataFrame lhs_df;
+    MyDataFrame rhs_df;
+
+    lhs_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 6, 1),
+        std::make_pair("sym", StlVecType<std::string> {
+            "IBM", "AAPL", "IBM", "MSFT", "AAPL", "IBM" }),
+        std::make_pair("date", StlVecType<int> {
+            20240102, 20240102, 20240103, 20240102, 20240103, 20240104 }),
+        std::make_pair("price", StlVecType<double> {
+            1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }),
+        std::make_pair("flag", StlVecType<int> { 1, 1, 1, 1, 2, 1 }));
+    rhs_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 5, 1),
+        std::make_pair("sym", StlVecType<std::string> {
+            "AAPL", "IBM", "IBM", "AAPL", "GOOG" }),
+        std::make_pair("date", StlVecType<int> {
+            20240103, 20240103, 20240102, 20240102, 20240102 }),
+        std::make_pair("shares", StlVecType<long> { 10, 20, 30, 40, 50 }),
+        std::make_pair("flag", StlVecType<int> { 1, 1, 1, 1, 1 }));
+
+    for (const auto ja : { join_algorithm::sort_merge, join_algorithm::hash })  {
+        auto    inner =
+            lhs_df.join_by_column<MyDataFrame, std::string, int,
+                                  double, long, std::string, int>
+                (rhs_df, "sym", "date", join_policy::inner_join, ja);
+
+        assert(inner.get_index().size() == 4);
+        inner.sort<unsigned long, unsigned long, double, long,
+                   std::string, int>
+            ("lhs.INDEX", sort_spec::ascen);
+        assert((inner.get_column<unsigned long>("lhs.INDEX") ==
+                StlVecType<unsigned long> { 0, 1, 2, 4 }));
+        assert((inner.get_column<unsigned long>("rhs.INDEX") ==
+                StlVecType<unsigned long> { 2, 3, 1, 0 }));
+        assert((inner.get_column<long>("shares") ==
+                StlVecType<long> { 30, 40, 20, 10 }));
+        assert((inner.get_column<std::string>("sym") ==
+                StlVecType<std::string> { "IBM", "AAPL", "IBM", "AAPL" }));
+        assert((inner.get_column<int>("date") ==
+                StlVecType<int> { 20240102, 20240102, 20240103,
+                                  20240103 }));
+
+        const auto  outer =
+            lhs_df.join_by_column<MyDataFrame, std::string, int,
+                                  double, long, std::string, int>
+                (rhs_df, "sym", "date", join_policy::left_right_join, ja);
+
+        assert(outer.get_index().size() == 7);
+        assert(outer.get_column<std::string>("sym").size() == 7);
+        assert(outer.get_column<double>("price").size() == 7);
+
+        const auto  right =
+            lhs_df.join_by_column<MyDataFrame, std::string, int,
+                                  double, long, std::string, int>
+                (rhs_df, "sym", "date", join_policy::right_join, ja);
+
+        assert(right.get_index().size() == 5);
+    }
+
+    const auto  three =
+        lhs_df.join_by_column<MyDataFrame, std::string, int, int,
+                              double, long, std::string, int>
+            (rhs_df, "sym", "date", "flag", join_policy::inner_join);
+
+    assert(three.get_index().size() == 3);
+    assert(three.get_column<int>("flag").size() == 3);
+    assert(! three.has_column("lhs.flag"));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_semi_anti_join()  {
+
+    std::cout << "\nTesting semi_anti_join( ) ..." << std::endl;
+
+    MyDataFrame lhs_df;
+    MyDataFrame rhs_df;
+
+    lhs_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 6, 1),
+        std::make_pair("sym", StlVecType<std::string> {
+            "IBM", "AAPL", "IBM", "MSFT", "AAPL", "GOOG" }),
+        std::make_pair("price", StlVecType<double> {
+            1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }));
+    rhs_df.load_data(
+        MyDataFrame::gen_sequence_index(2, 6, 1),
+        std::make_pair("sym", StlVecType<std::string> {
+            "AAPL", "IBM", "AAPL", "ORCL" }));
+
+    const auto  semi =
+        lhs_df.semi_join<MyDataFrame, std::string, std::string, double>
+            (rhs_df, "sym");
+
+    assert((semi.get_index() == StlVecType<unsigned long> { 0, 1, 2, 4 }));
+    assert((semi.get_column<double>("price") ==
+            StlVecType<double> { 1.0, 2.0, 3.0, 5.0 }));
+    assert(! semi.has_column("rhs.sym"));
+
+    const auto  anti =
+        lhs_df.anti_join<MyDataFrame, std::string, std::string, double>
+            (rhs_df, "sym");
+
+    assert((anti.get_index() == StlVecType<unsigned long> { 3, 5 }));
+    assert((anti.get_column<std::string>("sym") ==
+            StlVecType<std::string> { "MSFT", "GOOG" }));
+
+    auto    semi_view =
+        lhs_df.semi_join_view<MyDataFrame, unsigned long, std::string, double>
+            (rhs_df, DF_INDEX_COL_NAME);
+
+    assert(semi_view.get_index().size() == 4);
+    assert(semi_view.get_index()[0] == 2);
+    assert(semi_view.get_column<double>("price")[3] == 6.0);
+    semi_view.get_column<double>("price")[0] = 30.0;
+    assert(lhs_df.get_column<double>("price")[2] == 30.0);
+
+    const MyDataFrame   &const_lhs = lhs_df;
+    const auto          anti_view =
+        const_lhs.anti_join_view<MyDataFrame, unsigned long,
+                                 std::string, double>
+            (rhs_df, DF_INDEX_COL_NAME);
+
+    assert(anti_view.get_index().size() == 2);
+    assert(anti_view.get_index()[1] == 1);
+    assert(anti_view.get_column<std::string>("sym")[0] == "IBM");
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_join_by_interval()  {
+
+    std::cout << "\nTesting join_by_interval( ) ..." << std::endl;
+
+    MyDataFrame lhs_df;
+    MyDataFrame rhs_df;
+
+    // Order times are not sorted
+    //
+    lhs_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 6, 1),
+        std::make_pair("time", StlVecType<int> { 15, 3, 25, 40, 10, 21 }),
+        std::make_pair("qty", StlVecType<double> {
+            1.0, 2.0, 3.0, 4.0, 5.0, 6.0 }));
+
+    // Sessions [10, 20) and [20, 30) overlap the all day [0, 30), and
+    // [35, 35) is empty
+    //
+    rhs_df.load_data(
+        MyDataFrame::gen_sequence_index(100, 104, 1),
+        std::make_pair("begin", StlVecType<int> { 20, 10, 0, 35 }),
+        std::make_pair("end", StlVecType<int> { 30, 20, 30, 35 }),
+        std::make_pair("session", StlVecType<std::string> {
+            "pm", "am", "day", "empty" }));
+
+    const auto  inner =
+        lhs_df.join_by_interval<MyDataFrame, int, int, double, std::string>
+            (rhs_df, "time", "begin", "end");
+
+    assert((inner.get_index() ==
+            StlVecType<unsigned long> { 0, 0, 1, 2, 2, 4, 4, 5, 5 }));
+    assert((inner.get_column<std::string>("session") ==
+            StlVecType<std::string> {
+                "am", "day", "day", "pm", "day", "am", "day", "pm", "day" }));
+    assert((inner.get_column<double>("qty") ==
+            StlVecType<double> {
+                1.0, 1.0, 2.0, 3.0, 3.0, 5.0, 5.0, 6.0, 6.0 }));
+
+    const auto  left =
+        lhs_df.join_by_interval<MyDataFrame, int, int, double, std::string>
+            (rhs_df, "time", "begin", "end", join_policy::left_join);
+
+    assert(left.get_index().size() == 10);
+    assert(left.get_index()[5] == 3);
+    assert(left.get_column<double>("qty")[5] == 4.0);
+    assert(left.get_column<std::string>("session")[5].empty());
+
+    // With left_join, rows past the end of a short point column are kept
+    //
+    lhs_df.load_column("short_time", StlVecType<int> { 15, 3, 25, 40 },
+                       nan_policy::dont_pad_with_nans);
+
+    const auto  short_left =
+        lhs_df.join_by_interval<MyDataFrame, int, int, double, std::string>
+            (rhs_df, "short_time", "begin", "end", join_policy::left_join);
+
+    assert((short_left.get_index() ==
+            StlVecType<unsigned long> { 0, 0, 1, 2, 2, 3, 4, 5 }));
+    assert(short_left.get_column<double>("qty")[7] == 6.0);
+    assert(short_left.get_column<std::string>("session")[6].empty());
+    assert(short_left.get_column<std::string>("session")[7].empty());
+    assert((lhs_df.join_by_interval<MyDataFrame, int, int, double, std::string>
+                (rhs_df, "short_time", "begin", "end").get_index().size() ==
+            5));
+
+    MyDataFrame lhs_idx_df;
+    MyDataFrame rhs_idx_df;
+
+    lhs_idx_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 10, 1),
+        std::make_pair("val", StlVecType<double> {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    rhs_idx_df.load_data(
+        MyDataFrame::gen_sequence_index(0, 2, 1),
+        std::make_pair("begin", StlVecType<unsigned long> { 2, 8 }),
+        std::make_pair("end", StlVecType<unsigned long> { 4, 20 }));
+
+    const auto  idx_join =
+        lhs_idx_df.join_by_interval<MyDataFrame, unsigned long,
+                                    unsigned long, double>
+            (rhs_idx_df, DF_INDEX_COL_NAME, "begin", "end");
+
+    assert((idx_join.get_index() == StlVecType<unsigned long> { 2, 3, 8, 9 }));
+    assert((idx_join.get_column<unsigned long>("end") ==
+            StlVecType<unsigned long> { 4, 4, 20, 20 }));
+
+    try  {
+        auto    result =
+            lhs_df.join_by_interval<MyDataFrame, int, int, double, std::string>
+                (rhs_df, "time", "begin", "end", join_policy::right_join);
+
+        assert(false);
+    }
+    catch (const NotFeasible &)  {  }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_join_rows()  {
+
+    std::cout << "\nTesting join_rows( ) ..." << std::endl;
+
+    MyDataFrame lhs_df;
+    MyDataFrame rhs_df;
+
+    lhs_df.load_data(
+        StlVecType<unsigned long> { 5, 1, 3, 7, 3 },
+        std::make_pair("key", StlVecType<int> { 50, 10, 30, 70, 40 }),
+        std::make_pair("price", StlVecType<double> {
+            5.0, 1.0, 3.0, 7.0, 3.5 }),
+        std::make_pair("wide_1", StlVecType<double> { 1, 2, 3, 4, 5 }),
+        std::make_pair("wide_2", StlVecType<double> { 1, 2, 3, 4, 5 }));
+    rhs_df.load_data(
+        StlVecType<unsigned long> { 3, 2, 5, 9 },
+        std::make_pair("key", StlVecType<int> { 30, 20, 50, 90 }),
+        std::make_pair("price", StlVecType<double> { 30.0, 20.0, 50.0, 90.0 }),
+        std::make_pair("qty", StlVecType<long> { 300, 200, 500, 900 }));
+
+    for (const auto jp : { join_policy::inner_join, join_policy::left_join,
+                           join_policy::right_join,
+                           join_policy::left_right_join })  {
+        for (const auto ja : { join_algorithm::sort_merge,
+                               join_algorithm::hash })  {
+            const auto  rows =
+                lhs_df.join_by_index_rows<MyDataFrame>(rhs_df, jp, ja);
+            const auto  full =
+                lhs_df.join_by_index<MyDataFrame, double, long, int>
+                    (rhs_df, jp, ja);
+            const auto  part =
+                lhs_df.gather_join_columns<MyDataFrame, double, long, int>
+                    (rhs_df, rows, { "price", "key" }, { "price", "qty" });
+
+            assert(rows.size() == full.get_index().size());
+            assert(part.get_index() == full.get_index());
+            assert(! part.has_column("wide_1"));
+            assert(! part.has_column("rhs.key"));
+            assert(part.get_column<int>("key").size() ==
+                   full.get_column<int>("lhs.key").size());
+            for (std::size_t i = 0; i < rows.size(); ++i)  {
+                const auto  &lp = part.get_column<double>("lhs.price");
+                const auto  &fp = full.get_column<double>("lhs.price");
+                const auto  &lq = part.get_column<long>("qty");
+                const auto  &fq = full.get_column<long>("qty");
+
+                assert(i >= lp.size() || lp[i] == fp[i] ||
+                       (std::isnan(lp[i]) && std::isnan(fp[i])));
+                assert(i >= lq.size() || lq[i] == fq[i]);
+            }
+        }
+    }
+
+    const auto  col_rows =
+        lhs_df.join_by_column_rows<MyDataFrame, int>
+            (rhs_df, "key", join_policy::inner_join);
+
+    assert(col_rows.size() == 2);
+    assert((std::get<0>(col_rows[0]) == 2 && std::get<1>(col_rows[0]) == 0));
+    assert((std::get<0>(col_rows[1]) == 0 && std::get<1>(col_rows[1]) == 2));
+
+    const auto  col_part =
+        lhs_df.gather_join_columns<MyDataFrame, double, long, int>
+            (rhs_df, col_rows, { "wide_2" }, { "qty" });
+
+    assert((col_part.get_index() == StlVecType<unsigned long> { 3, 5 }));
+    assert((col_part.get_column<double>("wide_2") ==
+            StlVecType<double> { 3, 1 }));
+    assert((col_part.get_column<long>("qty") ==
+            StlVecType<long> { 300, 500 }));
+
+    try  {
+        auto    result =
+            lhs_df.gather_join_columns<MyDataFrame, double, long, int>
+                (rhs_df, col_rows, { "wide_3" }, { });
+
+        assert(false);
+    }
+    catch (const ColNotFound &)  {  }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_sel_parallel()  {
+
+    std::cout << "\nTesting sel_parallel( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 200000;
+    StlVecType<double>      dbl_vec(item_cnt);
+    StlVecType<int>         int_vec(item_cnt);
+    StlVecType<std::string> str_vec(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        dbl_vec[i] = double(i % 1000) * 0.5;
+        int_vec[i] = int(i % 7);
+        str_vec[i] = std::to_string(i % 13);
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("dbl_col", dbl_vec),
+                 std::make_pair("int_col", int_vec),
+                 std::make_pair("str_col", str_vec));
+
+    auto    sel_1 =
+        [](const unsigned long &, const double &val) -> bool  {
+            return (val > 300.0);
+        };
+    auto    sel_2 =
+        [](const unsigned long &idx, const double &, const int &val) -> bool  {
+            return (val == 3 && idx % 2 == 0);
+        };
+
+    const auto  serial_1 =
+        df.get_data_by_sel<double, decltype(sel_1), double, int, std::string>
+            ("dbl_col", sel_1);
+    const auto  serial_2 =
+        df.get_data_by_sel<double, int, decltype(sel_2),
+                           double, int, std::string>
+            ("dbl_col", "int_col", sel_2);
+
+    ThreadGranularity::set_thread_level(4);
+
+    // Only functors wrapped in concurrent_sel() are called from threads
+    //
+    auto        con_sel_1 = concurrent_sel(sel_1);
+    auto        con_sel_2 = concurrent_sel(sel_2);
+    const auto  par_1 =
+        df.get_data_by_sel<double, decltype(con_sel_1),
+                           double, int, std::string>
+            ("dbl_col", con_sel_1);
+    const auto  par_2 =
+        df.get_data_by_sel<double, int, decltype(con_sel_2),
+                           double, int, std::string>
+            ("dbl_col", "int_col", con_sel_2);
+    std::size_t calls = 0;
+    bool        in_order = true;
+    auto        stateful_sel =
+        [&calls, &in_order](const unsigned long &idx,
+                            const double &val) -> bool  {
+            in_order = in_order && idx == calls;
+            calls += 1;
+            return (val > 300.0);
+        };
+    const auto  ser_1 =
+        df.get_data_by_sel<double, decltype(stateful_sel), double>
+            ("dbl_col", stateful_sel);
+
+    assert(calls == item_cnt);
+    assert(in_order);
+    assert(ser_1.get_index() == serial_1.get_index());
+
+    assert(par_1.get_index().size() == item_cnt / 1000 * 399);
+    assert(par_1.get_index() == serial_1.get_index());
+    assert(par_1.get_column<double>("dbl_col") ==
+           serial_1.get_column<double>("dbl_col"));
+    assert(par_1.get_column<std::string>("str_col") ==
+           serial_1.get_column<std::string>("str_col"));
+    assert(par_2.get_index() == serial_2.get_index());
+    assert(par_2.get_column<int>("int_col") ==
+           serial_2.get_column<int>("int_col"));
+
+    MyDataFrame df2 = df;
+
+    df2.remove_data_by_sel<double, decltype(con_sel_1),
+                           double, int, std::string>
+        ("dbl_col", con_sel_1);
+    ThreadGranularity::set_thread_level(0);
+
+    assert(df2.get_index().size() == item_cnt - par_1.get_index().size());
+    assert(df2.get_index()[601] == 1000);
+    assert(df2.get_column<double>("dbl_col")[601] == 0.0);
+    assert(df2.get_column<int>("int_col")[601] == 1000 % 7);
+    assert(df2.get_column<std::string>("str_col")[601] ==
+           std::to_string(1000 % 13));
+    for (const auto val : df2.get_column<double>("dbl_col"))
+        assert(val <= 300.0);
+
+    df.remove_data_by_sel<double, int, decltype(sel_2),
+                          double, int, std::string>
+        ("dbl_col", "int_col", sel_2);
+    assert(df.get_index().size() == item_cnt - par_2.get_index().size());
+    assert(df.get_index()[10] == 11);
+    assert(df.get_column<int>("int_col")[10] == 4);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_get_data_by_pred()  {
+
+    std::cout << "\nTesting get_data_by_pred( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 100003;
+    StlVecType<double>      price(item_cnt);
+    StlVecType<long>        volume(item_cnt);
+    StlVecType<std::string> sym(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        price[i] = double(i % 100) + 0.5;
+        volume[i] = long(i % 37) * 100;
+        sym[i] = i % 3 == 0 ? "IBM" : (i % 3 == 1 ? "AAPL" : "MSFT");
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("price", price),
+                 std::make_pair("volume", volume),
+                 std::make_pair("sym", sym));
+
+    const auto  pred =
+        sel_col<double>("price") > 50.0 && sel_col<long>("volume") >= 1000;
+    auto        sel_functor =
+        [](const unsigned long &, const double &p, const long &v) -> bool  {
+            return (p > 50.0 && v >= 1000);
+        };
+    const auto  by_sel =
+        df.get_data_by_sel<double, long, decltype(sel_functor),
+                           double, long, std::string>
+            ("price", "volume", sel_functor);
+
+    for (const std::size_t thr : { 0, 4 })  {
+        ThreadGranularity::set_thread_level(thr);
+
+        const auto  by_pred =
+            df.get_data_by_pred<decltype(pred), double, long, std::string>
+                (pred);
+
+        assert(by_pred.get_index() == by_sel.get_index());
+        assert(by_pred.get_column<std::string>("sym") ==
+               by_sel.get_column<std::string>("sym"));
+        assert(df.count_by_pred(pred) == by_sel.get_index().size());
+    }
+    ThreadGranularity::set_thread_level(0);
+
+    // Ranges, IN lists, negation, and the index
+    //
+    const auto  pred2 =
+        (sel_col<double>("price").between(10.0, 12.0) ||
+         sel_col<std::string>("sym").in({ "MSFT" })) &&
+        ! (sel_col<unsigned long>(DF_INDEX_COL_NAME) >= 100UL);
+    const auto  view =
+        df.get_view_by_pred<decltype(pred2), double, long, std::string>
+            (pred2);
+    StlVecType<unsigned long>   expected;
+
+    for (unsigned long i = 0; i < 100; ++i)
+        if ((price[i] >= 10.0 && price[i] < 12.0) || sym[i] == "MSFT")
+            expected.push_back(i);
+    assert(view.get_index().size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        assert(view.get_index()[i] == expected[i]);
+
+    // In list longer than 8 and a functor fallback
+    //
+    const auto  pred3 =
+        sel_col<long>("volume").in({ 0, 100, 200, 300, 400, 500, 600, 700,
+                                     800, 900, 1000 }) &&
+        sel_col<std::string>("sym").where(
+            [](const std::string &s) -> bool { return (s[0] == 'I'); });
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        if (volume[i] <= 1000 && sym[i] == "IBM")  count += 1;
+    assert(df.count_by_pred(pred3) == count);
+    assert((df.count_by_pred(! pred3) == item_cnt - count));
+    assert(df.count_by_pred(sel_col<double>("price") != 0.5) ==
+           item_cnt - df.count_by_pred(sel_col<double>("price") == 0.5));
+
+    // Rows past the end of a short column do not match, negated or not
+    //
+    StlVecType<long>    short_col(130);
+
+    for (std::size_t i = 0; i < short_col.size(); ++i)
+        short_col[i] = long(i % 2);
+    df.load_column("short", std::move(short_col),
+                   nan_policy::dont_pad_with_nans);
+
+    const auto  pred4 = sel_col<long>("short") == 1L;
+
+    assert(df.count_by_pred(pred4) == 65);
+    assert(df.count_by_pred(! pred4) == 65);
+    assert(df.count_by_pred(! (! pred4)) == 65);
+    assert((df.count_by_pred(! (pred4 && sel_col<double>("price") > 0.0)) ==
+            65));
+    assert((df.count_by_pred(! (pred4 || sel_col<double>("price") < 0.0)) ==
+            65));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_query()  {
+
+    std::cout << "\nTesting query( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 50021;
+    StlVecType<double>      price(item_cnt);
+    StlVecType<long>        volume(item_cnt);
+    StlVecType<int>         unused(item_cnt, 7);
+    StlVecType<std::string> sym(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        price[i] = double(i % 100) + 0.5;
+        volume[i] = long(i % 37) * 100;
+        sym[i] = i % 3 == 0 ? "IBM" : (i % 3 == 1 ? "AAPL" : "MSFT");
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("price", price),
+                 std::make_pair("volume", volume),
+                 std::make_pair("unused", unused),
+                 std::make_pair("sym", sym));
+
+    const auto  pred =
+        sel_col<double>("price") > 50.0 && sel_col<long>("volume") >= 1000;
+    const auto  by_pred =
+        df.get_data_by_pred<decltype(pred), double, long, int, std::string>
+            (pred);
+    const auto  grouped =
+        by_pred.groupby1<std::string>(
+            "sym",
+            LastVisitor<MyDataFrame::IndexType, MyDataFrame::IndexType>(),
+            std::make_tuple("price", "avg_price", MeanVisitor<double>()),
+            std::make_tuple("volume", "sum_volume", SumVisitor<long>()));
+
+    for (const std::size_t thr : { 0, 4 })  {
+        ThreadGranularity::set_thread_level(thr);
+
+        // Two separate filters are ANDed, only two columns are copied
+        //
+        auto        q = df.query();
+        const auto  res =
+            q.where(sel_col<double>("price") > 50.0)
+             .where(sel_col<long>("volume") >= 1000)
+             .select({ "price", "sym" })
+             .collect<double, long, int, std::string>();
+
+        assert(res.get_index() == by_pred.get_index());
+        assert(res.get_column<double>("price") ==
+               by_pred.get_column<double>("price"));
+        assert(res.get_column<std::string>("sym") ==
+               by_pred.get_column<std::string>("sym"));
+        assert(! res.has_column("volume"));
+        assert(! res.has_column("unused"));
+        assert(q.count() == by_pred.get_index().size());
+
+        SumVisitor<double>  q_sum;
+        SumVisitor<double>  sel_sum;
+
+        q.visit<double>("price", q_sum);
+        by_pred.visit<double>("price", sel_sum);
+        assert(q_sum.get_result() == sel_sum.get_result());
+
+        // Only sym, price, and volume are gathered for the groupby
+        //
+        const auto  gres =
+            df.query()
+              .where(pred)
+              .groupby<std::string>(
+                  "sym",
+                  LastVisitor<MyDataFrame::IndexType,
+                              MyDataFrame::IndexType>(),
+                  std::make_tuple("price", "avg_price",
+                                  MeanVisitor<double>()),
+                  std::make_tuple("volume", "sum_volume",
+                                  SumVisitor<long>()))
+              .collect<double, long, int, std::string>();
+
+        assert(gres.get_index() == grouped.get_index());
+        assert(gres.get_column<std::string>("sym") ==
+               grouped.get_column<std::string>("sym"));
+        assert(gres.get_column<double>("avg_price") ==
+               grouped.get_column<double>("avg_price"));
+        assert(gres.get_column<long>("sum_volume") ==
+               grouped.get_column<long>("sum_volume"));
+    }
+    ThreadGranularity::set_thread_level(0);
+
+    // A query over a view returns a StdDataFrame
+    //
+    const auto  view =
+        df.get_view_by_pred<decltype(pred), double, long, int, std::string>
+            (pred);
+    const auto  vres =
+        view.query()
+            .where(sel_col<std::string>("sym") == std::string("IBM"))
+            .select({ "volume" })
+            .collect<double, long, int, std::string>();
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        if (price[i] > 50.0 && volume[i] >= 1000 && sym[i] == "IBM")  {
+            assert(vres.get_index()[count] == i);
+            assert(vres.get_column<long>("volume")[count] == volume[i]);
+            count += 1;
+        }
+    assert(vres.get_index().size() == count);
+    assert(view.query().count() == by_pred.get_index().size());
+
+    // The whole frame, with no steps, is a plain copy
+    //
+    const auto  all = df.query().collect<double, long, int, std::string>();
+
+    assert(all.get_index().size() == item_cnt);
+    assert(all.get_column<int>("unused") == unused);
+
+    try  {
+        (void) df.query().select({ "no_such_col" }).collect<double>();
+        assert(false);
+    }
+    catch (const ColNotFound &)  {   }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_multi_visit_fused()  {
+
+    std::cout << "\nTesting multi_visit_fused( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 10007;
+    StlVecType<double>      dbl_col(item_cnt);
+    StlVecType<double>      short_col(item_cnt / 2);
+    StlVecType<long>        lng_col(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        dbl_col[i] = double(i % 113) * 0.25 - 7.0;
+        lng_col[i] = long(i % 41);
+    }
+    for (std::size_t i = 0; i < short_col.size(); ++i)
+        short_col[i] = double(i % 17);
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("dbl_col", dbl_col),
+                 std::make_pair("lng_col", lng_col));
+    df.load_column("short_col", std::move(short_col),
+                   nan_policy::dont_pad_with_nans);
+
+    MeanVisitor<double> mean_ref;
+    StdVisitor<double>  std_ref;
+    MinVisitor<double>  min_ref;
+    MaxVisitor<double>  max_ref;
+    SumVisitor<long>    sum_ref;
+    CountVisitor<double>    cnt_ref;
+
+    df.visit<double>("dbl_col", mean_ref);
+    df.visit<double>("dbl_col", std_ref);
+    df.visit<double>("dbl_col", min_ref);
+    df.visit<double>("dbl_col", max_ref);
+    df.visit<long>("lng_col", sum_ref);
+    df.visit<double>("short_col", cnt_ref);
+
+    for (const std::size_t thr : { 0, 4 })  {
+        ThreadGranularity::set_thread_level(thr);
+
+        MeanVisitor<double> mean_v;
+        StdVisitor<double>  std_v;
+        MinVisitor<double>  min_v;
+        MaxVisitor<double>  max_v;
+        SumVisitor<long>    sum_v;
+        CountVisitor<double>    cnt_v;
+
+        df.multi_visit_fused(std::make_pair("dbl_col", &mean_v),
+                             std::make_pair("lng_col", &sum_v),
+                             std::make_pair("dbl_col", &std_v),
+                             std::make_pair("short_col", &cnt_v),
+                             std::make_pair("dbl_col", &min_v),
+                             std::make_pair("dbl_col", &max_v));
+        assert(mean_v.get_result() == mean_ref.get_result());
+        assert(std_v.get_result() == std_ref.get_result());
+        assert(min_v.get_result() == min_ref.get_result());
+        assert(max_v.get_result() == max_ref.get_result());
+        assert(sum_v.get_result() == sum_ref.get_result());
+        assert(cnt_v.get_result() == cnt_ref.get_result());
+        assert(cnt_v.get_result() == item_cnt / 2);
+    }
+    ThreadGranularity::set_thread_level(0);
+
+    const MyDataFrame   &const_df = df;
+    MeanVisitor<double> mean_v;
+
+    const_df.multi_visit_fused(std::make_pair("dbl_col", &mean_v));
+    assert(mean_v.get_result() == mean_ref.get_result());
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_describe_stats()  {
+
+    std::cout << "\nTesting describe_stats( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 20001;
+    StlVecType<double>      dbl_col(item_cnt);
+    StlVecType<long>        lng_col(item_cnt);
+    constexpr double        nan = std::numeric_limits<double>::quiet_NaN();
+    StlVecType<double>      nan_col { 4.0, 1.0, nan, 3.0, 2.0, nan, 5.0 };
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        dbl_col[i] = double((i * 7919) % item_cnt) * 0.5;
+        lng_col[i] = long((i * 104729) % 1000);
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("dbl_col", dbl_col),
+                 std::make_pair("lng_col", lng_col));
+    df.load_column("nan_col", std::move(nan_col),
+                   nan_policy::dont_pad_with_nans);
+
+    const auto  desc = df.describe<double, long>();
+
+    ThreadGranularity::set_thread_level(4);
+
+    const auto  par_desc = df.describe<double, long>();
+
+    ThreadGranularity::set_thread_level(0);
+
+    for (const char *name : { "dbl_col", "lng_col" })
+        assert(desc.get_column<double>(name) ==
+               par_desc.get_column<double>(name));
+
+    // Compare against the visitors
+    //
+    for (const char *name : { "dbl_col" })  {
+        const auto  &stats = desc.get_column<double>(name);
+
+        StdVisitor<double>      std_v;
+        QuantileVisitor<double> qt25(0.25);
+        QuantileVisitor<double> qt50(0.5);
+        QuantileVisitor<double> qt75(0.75);
+
+        df.visit<double>(name, std_v);
+        df.single_act_visit<double>(name, qt25);
+        df.single_act_visit<double>(name, qt50);
+        df.single_act_visit<double>(name, qt75);
+        assert(stats[0] == double(item_cnt));
+        assert(stats[1] == 0);
+        assert(std::fabs(stats[3] - std_v.get_result()) < 0.000001);
+        assert(stats[4] == 0);
+        assert(stats[5] == double(item_cnt - 1) * 0.5);
+        assert(stats[6] == qt25.get_result());
+        assert(stats[7] == qt50.get_result());
+        assert(stats[8] == qt75.get_result());
+    }
+
+    // Missing values are counted, but left out of the other statistics
+    //
+    const auto  &nan_stats = desc.get_column<double>("nan_col");
+
+    assert(nan_stats[0] == 7);
+    assert(nan_stats[1] == 2);
+    assert(nan_stats[2] == 3.0);
+    assert(std::fabs(nan_stats[3] - std::sqrt(2.5)) < 0.000001);
+    assert(nan_stats[4] == 1.0);
+    assert(nan_stats[5] == 5.0);
+    assert(nan_stats[6] == 1.5);
+    assert(nan_stats[7] == 3.0);
+    assert(nan_stats[8] == 4.0);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_cum_scan_parallel()  {
+
+    std::cout << "\nTesting cum_scan_parallel( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 300007;
+    constexpr double        nan = std::numeric_limits<double>::quiet_NaN();
+    StlVecType<double>      dbl_col(item_cnt);
+    StlVecType<double>      prod_col(item_cnt);
+    StlVecType<long>        lng_col(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        dbl_col[i] = double((i * 7919) % 1013) * 0.1 - 40.0;
+        prod_col[i] = 1.0 + double(i % 7) * 0.000001;
+        lng_col[i] = long((i * 104729) % 997) - 400;
+    }
+
+    // NaNs near the start and around the block boundaries
+    //
+    for (const std::size_t i : { std::size_t(1), std::size_t(75001),
+                                 std::size_t(150001), std::size_t(150002),
+                                 std::size_t(225001) })  {
+        dbl_col[i] = nan;
+        prod_col[i] = nan;
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("dbl_col", dbl_col),
+                 std::make_pair("prod_col", prod_col),
+                 std::make_pair("lng_col", lng_col));
+
+    auto    run = [&df](auto &visitor, const char *name) -> void  {
+        using V = typename std::remove_reference<decltype(visitor)>::type;
+
+        df.single_act_visit<typename V::value_type>(name, visitor);
+    };
+    auto    same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)  {
+            if (std::isnan(double(lhs[i])) || std::isnan(double(rhs[i])))  {
+                if (! (std::isnan(double(lhs[i])) &&
+                       std::isnan(double(rhs[i]))))
+                    return (false);
+            }
+            else if (std::fabs(double(lhs[i] - rhs[i])) >
+                         0.000001 * std::max(1.0, std::fabs(double(lhs[i]))))
+                return (false);
+        }
+        return (true);
+    };
+
+    for (const bool skip_nan : { true, false })  {
+        CumSumVisitor<double>   sum_s(skip_nan);
+        CumSumVisitor<long>     lsum_s(skip_nan);
+        CumProdVisitor<double>  prod_s(skip_nan);
+        CumMaxVisitor<double>   max_s(skip_nan);
+        CumMinVisitor<double>   min_s(skip_nan);
+        CumMaxVisitor<long>     lmax_s(skip_nan);
+
+        run(sum_s, "dbl_col");
+        run(lsum_s, "lng_col");
+        run(prod_s, "prod_col");
+        run(max_s, "dbl_col");
+        run(min_s, "dbl_col");
+        run(lmax_s, "lng_col");
+
+        ThreadGranularity::set_thread_level(4);
+
+        CumSumVisitor<double>   sum_p(skip_nan);
+        CumSumVisitor<long>     lsum_p(skip_nan);
+        CumProdVisitor<double>  prod_p(skip_nan);
+        CumMaxVisitor<double>   max_p(skip_nan);
+        CumMinVisitor<double>   min_p(skip_nan);
+        CumMaxVisitor<long>     lmax_p(skip_nan);
+
+        run(sum_p, "dbl_col");
+        run(lsum_p, "lng_col");
+        run(prod_p, "prod_col");
+        run(max_p, "dbl_col");
+        run(min_p, "dbl_col");
+        run(lmax_p, "lng_col");
+
+        ThreadGranularity::set_thread_level(0);
+
+        assert(same(sum_s.get_result(), sum_p.get_result()));
+        assert(lsum_s.get_result() == lsum_p.get_result());
+        assert(same(prod_s.get_result(), prod_p.get_result()));
+        assert(same(max_s.get_result(), max_p.get_result()));
+        assert(same(min_s.get_result(), min_p.get_result()));
+        assert(lmax_s.get_result() == lmax_p.get_result());
+    }
+
+    // A sequential reference for the skip-NaN cumulative max
+    //
+    CumMaxVisitor<double>   max_v;
+
+    ThreadGranularity::set_thread_level(4);
+    run(max_v, "dbl_col");
+    ThreadGranularity::set_thread_level(0);
+
+    double  running = nan;
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        if (std::isnan(dbl_col[i]))
+            assert(std::isnan(max_v.get_result()[i]));
+        else  {
+            if (! (running >= dbl_col[i]))  running = dbl_col[i];
+            assert(max_v.get_result()[i] == running);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_ewm_parallel()  {
+
+    std::cout << "\nTesting ewm_parallel( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 300007;
+    constexpr double        nan = std::numeric_limits<double>::quiet_NaN();
+    StlVecType<double>      x_col(item_cnt);
+    StlVecType<double>      y_col(item_cnt);
+    StlVecType<double>      nan_col(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        x_col[i] = 100.0 + double((i * 7919) % 1013) * 0.01;
+        y_col[i] = 50.0 + double((i * 104729) % 997) * 0.02 + x_col[i] * 0.1;
+        nan_col[i] = x_col[i];
+    }
+
+    // NaNs at the start and around the block boundaries
+    //
+    for (const std::size_t i : { std::size_t(0), std::size_t(75001),
+                                 std::size_t(150001), std::size_t(150002),
+                                 std::size_t(225001) })
+        nan_col[i] = nan;
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("x_col", x_col),
+                 std::make_pair("y_col", y_col),
+                 std::make_pair("nan_col", nan_col));
+
+    auto    same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)  {
+            if (std::isnan(lhs[i]) || std::isnan(rhs[i]))  {
+                if (! (std::isnan(lhs[i]) && std::isnan(rhs[i])))
+                    return (false);
+            }
+            else if (std::fabs(lhs[i] - rhs[i]) >
+                         0.000001 * std::max(1.0, std::fabs(lhs[i])))
+                return (false);
+        }
+        return (true);
+    };
+
+    ewm_v<double>       mean_s(exponential_decay_spec::span, 3);
+    ewm_v<double>       amean_s(exponential_decay_spec::span, 3, true);
+    ewm_var_v<double>   var_s(exponential_decay_spec::span, 3);
+    ewm_cov_v<double>   cov_s(exponential_decay_spec::halflife, 5);
+    ewm_corr_v<double>  corr_s(exponential_decay_spec::span, 10);
+
+    df.single_act_visit<double>("nan_col", mean_s);
+    df.single_act_visit<double>("nan_col", amean_s);
+    df.single_act_visit<double>("x_col", var_s);
+    df.single_act_visit<double, double>("x_col", "y_col", cov_s);
+    df.single_act_visit<double, double>("x_col", "y_col", corr_s);
+
+    ThreadGranularity::set_thread_level(4);
+
+    ewm_v<double>       mean_p(exponential_decay_spec::span, 3);
+    ewm_v<double>       amean_p(exponential_decay_spec::span, 3, true);
+    ewm_var_v<double>   var_p(exponential_decay_spec::span, 3);
+    ewm_cov_v<double>   cov_p(exponential_decay_spec::halflife, 5);
+    ewm_corr_v<double>  corr_p(exponential_decay_spec::span, 10);
+
+    df.single_act_visit<double>("nan_col", mean_p);
+    df.single_act_visit<double>("nan_col", amean_p);
+    df.single_act_visit<double>("x_col", var_p);
+    df.single_act_visit<double, double>("x_col", "y_col", cov_p);
+    df.single_act_visit<double, double>("x_col", "y_col", corr_p);
+
+    ThreadGranularity::set_thread_level(0);
+
+    assert(same(mean_s.get_result(), mean_p.get_result()));
+    assert(same(amean_s.get_result(), amean_p.get_result()));
+    assert(same(var_s.get_result(), var_p.get_result()));
+    assert(same(var_s.get_std(), var_p.get_std()));
+    assert(same(cov_s.get_result(), cov_p.get_result()));
+    assert(same(corr_s.get_result(), corr_p.get_result()));
+
+    // A missing value restarts the non-adjusted mean
+    //
+    assert(mean_p.get_result()[0] == 0);
+    assert(mean_p.get_result()[1] == nan_col[1]);
+    assert(mean_p.get_result()[150002] == 0);
+    assert(std::fabs(mean_p.get_result()[150003] - 0.5 * nan_col[150003]) <
+               0.000001);
+
+    // Spot check the variance against its direct definition
+    //
+    const double    decay_comp = 0.5;
+
+    for (const std::size_t i : { std::size_t(1), std::size_t(50),
+                                 std::size_t(150001), item_cnt - 1 })  {
+        double  sum_weights = 0;
+        double  sum_sq_weights = 0;
+        double  sum_weighted = 0;
+        double  factor_sum = 0;
+        double  weight = 1;
+
+        for (std::size_t j = 0; j <= i && weight > 0; ++j)  {
+            sum_weights += weight;
+            sum_sq_weights += weight * weight;
+            sum_weighted += weight * x_col[i - j];
+            weight *= decay_comp;
+        }
+        weight = 1;
+        for (std::size_t j = 0; j <= i && weight > 0; ++j)  {
+            const double    diff = x_col[i - j] - sum_weighted / sum_weights;
+
+            factor_sum += weight * diff * diff;
+            weight *= decay_comp;
+        }
+
+        const double    sum_weights_sq = sum_weights * sum_weights;
+        const double    var =
+            sum_weights_sq / (sum_weights_sq - sum_sq_weights) *
+            factor_sum / sum_weights;
+
+        assert(std::fabs(var_p.get_result()[i] - var) < 0.000001);
+    }
+    assert(std::isnan(var_p.get_result()[0]));
+    assert(std::isnan(corr_p.get_result()[0]));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_single_act_visit_panel()  {
+
+    std::cout << "\nTesting single_act_visit_panel( ) ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 2000;
+    constexpr std::size_t       col_cnt = 16;
+    MyDataFrame                 df;
+    StlVecType<std::string>     names;
+    StlVecType<std::string>     new_names;
+
+    df.load_index(MyDataFrame::gen_sequence_index(0, item_cnt, 1));
+    for (std::size_t c = 0; c < col_cnt; ++c)  {
+        StlVecType<double>  col(item_cnt);
+
+        for (std::size_t i = 0; i < item_cnt; ++i)
+            col[i] = 100.0 + double(((i + 1) * (c + 3) * 7919) % 1013) * 0.1;
+        names.push_back("SYM_" + std::to_string(c));
+        new_names.push_back("SYM_" + std::to_string(c) + "_rsi");
+        df.load_column(names.back().c_str(), std::move(col));
+    }
+
+    StlVecType<const char *>    col_names;
+    StlVecType<const char *>    new_col_names;
+
+    for (std::size_t c = 0; c < col_cnt; ++c)  {
+        col_names.push_back(names[c].c_str());
+        new_col_names.push_back(new_names[c].c_str());
+    }
+
+    const rsi_v<double, unsigned long, 256> rsi(return_policy::monetary, 14);
+
+    ThreadGranularity::set_thread_level(4);
+    assert((df.single_act_visit_panel<double>
+                (col_names, rsi, new_col_names) == item_cnt * col_cnt));
+    ThreadGranularity::set_thread_level(0);
+
+    // Every panel column is what a single visit of its column loads
+    //
+    for (std::size_t c = 0; c < col_cnt; ++c)  {
+        rsi_v<double, unsigned long, 256>   single(return_policy::monetary,
+                                                   14);
+
+        df.single_act_visit<double>(col_names[c], single);
+
+        const auto  &panel = df.get_column<double>(new_col_names[c]);
+        const auto  &result = single.get_result();
+
+        assert(panel.size() == item_cnt);
+        for (std::size_t i = 0; i < item_cnt; ++i)  {
+            if (i < result.size() && ! std::isnan(result[i]))
+                assert(panel[i] == result[i]);
+            else
+                assert(std::isnan(panel[i]));
+        }
+    }
+    assert(rsi.get_result().empty());
+
+    try  {
+        new_col_names.pop_back();
+        df.single_act_visit_panel<double>(col_names, rsi, new_col_names);
+        assert(false);
+    }
+    catch (const InconsistentData &)  {  }
+
+    try  {
+        StlVecType<const char *>    bad_names = { "SYM_0", "NO_SUCH_COL" };
+        StlVecType<const char *>    bad_new_names = { "X", "Y" };
+
+        df.single_act_visit_panel<double>(bad_names, rsi, bad_new_names);
+        assert(false);
+    }
+    catch (const ColNotFound &)  {  }
+    assert(! df.has_column("X"));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_single_act_visit_grouped()  {
+
+    std::cout << "\nTesting single_act_visit_grouped( ) ..." << std::endl;
+
+    constexpr std::size_t       item_cnt = 1000;
+    const std::string           symbols[] = { "IBM", "AAPL", "MSFT", "GE" };
+    StlVecType<double>          prices(item_cnt);
+    StlVecType<std::string>     keys;
+
+    // Time interleaved rows, not in a fixed order. The last few rows have
+    // no key.
+    //
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        prices[i] = 100.0 + double((i * 7919) % 1013) * 0.1;
+        if (i < item_cnt - 5)
+            keys.push_back(symbols[((i * 31) / 7) % 4]);
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("price", prices),
+                 std::make_pair("symbol", keys));
+
+    using mean_roller_t =
+        SimpleRollAdopter<MeanVisitor<double, unsigned long>,
+                          double, unsigned long, 256>;
+
+    const mean_roller_t                     roller(MeanVisitor<double>(), 5);
+    const ewm_v<double, unsigned long, 256> ewm(exponential_decay_spec::span,
+                                                10);
+
+    ThreadGranularity::set_thread_level(4);
+    assert((df.single_act_visit_grouped<std::string, double>
+                ("symbol", "price", roller, "price_roll") == 4));
+    ThreadGranularity::set_thread_level(0);
+    assert((df.single_act_visit_grouped<std::string, double>
+                ("symbol", "price", ewm, "price_ewm") == 4));
+
+    // A bool result column is scattered without data races
+    //
+    FactorizeVisitor<double>    fact(
+        [](const double &val) -> bool { return (val > 150.0); });
+
+    ThreadGranularity::set_thread_level(4);
+    assert((df.single_act_visit_grouped<std::string, double>
+                ("symbol", "price", fact, "price_high") == 4));
+    ThreadGranularity::set_thread_level(0);
+
+    const auto  &high_col = df.get_column<bool>("price_high");
+
+    assert(high_col.size() == item_cnt);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        assert(high_col[i] == (prices[i] > 150.0));
+
+    const auto  &roll_col = df.get_column<double>("price_roll");
+    const auto  &ewm_col = df.get_column<double>("price_ewm");
+
+    assert(roll_col.size() == item_cnt);
+    assert(ewm_col.size() == item_cnt);
+    for (std::size_t i = item_cnt - 5; i < item_cnt; ++i)
+        assert(std::isnan(roll_col[i]) && std::isnan(ewm_col[i]));
+
+    // Each symbol matches visiting that symbol's rows by themselves
+    //
+    for (const std::string &sym : symbols)  {
+        StlVecType<unsigned long>   rows;
+        StlVecType<double>          sym_prices;
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            if (keys[i] == sym)  {
+                rows.push_back(i);
+                sym_prices.push_back(prices[i]);
+            }
+
+        MyDataFrame     sym_df;
+        mean_roller_t   sym_roller(MeanVisitor<double>(), 5);
+        ewm_v<double, unsigned long, 256>
+                        sym_ewm(exponential_decay_spec::span, 10);
+
+        sym_df.load_data(StlVecType<unsigned long>(rows),
+                         std::make_pair("price", sym_prices));
+        sym_df.single_act_visit<double>("price", sym_roller);
+        sym_df.single_act_visit<double>("price", sym_ewm);
+
+        assert(rows.size() > 5);
+        for (std::size_t j = 0; j < rows.size(); ++j)  {
+            const double    roll = sym_roller.get_result()[j];
+
+            assert((std::isnan(roll) && std::isnan(roll_col[rows[j]])) ||
+                   roll == roll_col[rows[j]]);
+            assert(sym_ewm.get_result()[j] == ewm_col[rows[j]]);
+        }
+    }
+    assert(roller.get_result().empty());
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_derived_cache()  {
+
+    std::cout << "\nTesting derived_cache( ) ..." << std::endl;
+
+    using bb_t = BollingerBand<double, unsigned long, 256>;
+    using macd_t = macd_v<double, unsigned long, 256>;
+    using trix_t = trix_v<double, unsigned long, 256>;
+    using kch_t = kch_v<double, unsigned long, 256>;
+
+    constexpr std::size_t   item_cnt = 1000;
+    MyDataFrame             df;
+    StlVecType<double>      close(item_cnt);
+    StlVecType<double>      low(item_cnt);
+    StlVecType<double>      high(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        close[i] = 100.0 + double((i * 7919) % 1013) * 0.1;
+        low[i] = close[i] - 1.5;
+        high[i] = close[i] + 2.5;
+    }
+    df.load_data(MyDataFrame::gen_sequence_index(0, item_cnt, 1),
+                 std::make_pair("close", close),
+                 std::make_pair("low", low),
+                 std::make_pair("high", high));
+
+    // Results are compared item by item, since rolling results lead with NaNs
+    //
+    const auto  same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            if (! (lhs[i] == rhs[i] ||
+                   (std::isnan(lhs[i]) && std::isnan(rhs[i]))))
+                return (false);
+        return (true);
+    };
+
+    // References computed without the cache
+    //
+    bb_t    bb_ref (2.0, 2.0, 20);
+    macd_t  macd_ref (12, 26, 9);
+    trix_t  trix_ref (14);
+    kch_t   kch_ref (14);
+
+    df.single_act_visit<double>("close", bb_ref);
+    df.single_act_visit<double>("close", macd_ref);
+    df.single_act_visit<double>("close", trix_ref);
+    df.single_act_visit<double, double, double>("low", "high", "close",
+                                                kch_ref);
+    assert(df.get_derived_cache() == nullptr);
+
+    df.enable_derived_cache();
+
+    const DerivedCache  &cache = *(df.get_derived_cache());
+
+    ThreadGranularity::set_thread_level(4);
+    for (std::size_t n = 0; n < 2; ++n)  {
+        bb_t    bb (2.0, 2.0, 20);
+
+        df.single_act_visit<double>("close", bb);
+        assert(same(bb.get_upper_band_to_raw(),
+                    bb_ref.get_upper_band_to_raw()));
+        assert(same(bb.get_raw_to_lower_band(),
+                    bb_ref.get_raw_to_lower_band()));
+    }
+    ThreadGranularity::set_thread_level(0);
+    assert(cache.miss_count() == 2);  // Moving mean and std
+    assert(cache.hit_count() == 2);
+    assert(cache.size() == 2);
+
+    for (std::size_t n = 0; n < 2; ++n)  {
+        macd_t  macd (12, 26, 9);
+
+        df.single_act_visit<double>("close", macd);
+        assert(same(macd.get_macd_line(), macd_ref.get_macd_line()));
+        assert(same(macd.get_signal_line(), macd_ref.get_signal_line()));
+        assert(same(macd.get_macd_histogram(),
+                    macd_ref.get_macd_histogram()));
+    }
+    assert(cache.miss_count() == 4);  // Short and long EMA
+    assert(cache.hit_count() == 4);
+
+    // Trix and Keltner channels share the same EMA of close
+    //
+    trix_t  trix (14);
+    kch_t   kch (14);
+
+    df.single_act_visit<double>("close", trix);
+    df.single_act_visit<double, double, double>("low", "high", "close", kch);
+    assert(same(trix.get_result(), trix_ref.get_result()));
+    assert(same(kch.get_upper_band(), kch_ref.get_upper_band()));
+    assert(same(kch.get_lower_band(), kch_ref.get_lower_band()));
+    assert(cache.miss_count() == 5);
+    assert(cache.hit_count() == 5);
+    assert(cache.size() == 5);
+
+    // Reloading a column drops its series
+    //
+    const std::size_t   ver = cache.version("close");
+
+    for (auto &val : close)  val *= 1.01;
+    df.load_column("close", close);
+    assert(cache.version("close") > ver);
+    assert(cache.size() == 0);
+
+    bb_t    bb_ref2 (2.0, 2.0, 20);
+    bb_t    bb2 (2.0, 2.0, 20);
+
+    df.enable_derived_cache(false);
+    df.single_act_visit<double>("close", bb_ref2);
+    assert(df.get_derived_cache() == nullptr);
+    df.enable_derived_cache();
+    df.single_act_visit<double>("close", bb2);
+    assert(same(bb2.get_upper_band_to_raw(),
+                bb_ref2.get_upper_band_to_raw()));
+    assert(! same(bb2.get_upper_band_to_raw(),
+                  bb_ref.get_upper_band_to_raw()));
+    assert(df.get_derived_cache()->size() == 2);
+
+    // Changing a column in place requires touch_column()
+    //
+    df.get_column<double>("close")[100] += 1.0;
+    df.touch_column("close");
+    assert(df.get_derived_cache()->size() == 0);
+
+    // Reverse visits are never served from the cache
+    //
+    bb_t    bb3 (2.0, 2.0, 20);
+
+    df.single_act_visit<double>("close", bb3, true);
+    assert(df.get_derived_cache()->size() == 0);
+
+    // Changing the index bumps all versions, but only if anything changed
+    //
+    const std::size_t   idx_ver = df.get_derived_cache()->version("close");
+    const unsigned long first = df.get_index()[0];
+
+    assert(df.replace_index({ first + 1000000 }, { first }) == 0);
+    assert(df.get_derived_cache()->version("close") == idx_ver);
+    assert(df.replace_index({ first }, { first + 1000000 }) == 1);
+    assert(df.get_derived_cache()->version("close") > idx_ver);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_streaming_update()  {
+
+    std::cout << "\nTesting streaming_update( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 500;
+    constexpr std::size_t   head_cnt = 400;
+    StlVecType<unsigned long>   idx(item_cnt);
+    StlVecType<double>          close(item_cnt);
+    StlVecType<double>          low(item_cnt);
+    StlVecType<double>          high(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        idx[i] = i;
+        close[i] = 100.0 + double((i * 7919) % 1013) * 0.01 +
+                   10.0 * std::sin(double(i) / 20.0);
+        low[i] = close[i] - double(i % 7) * 0.1 - 0.5;
+        high[i] = close[i] + double(i % 5) * 0.1 + 0.5;
+    }
+
+    const auto  same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            if (! (lhs[i] == rhs[i] ||
+                   (std::isnan(lhs[i]) && std::isnan(rhs[i]))))
+                return (false);
+        return (true);
+    };
+
+    // A visit of the head, followed by one update per row of the tail, is
+    // the same as a visit of all rows
+    //
+    for (const bool finite_adjust : { false, true })  {
+        StlVecType<double>  col { close };
+
+        col[0] = col[3] = col[450] = std::numeric_limits<double>::quiet_NaN();
+
+        ewm_v<double>   full(exponential_decay_spec::span, 10, finite_adjust);
+        ewm_v<double>   stream(exponential_decay_spec::span, 10,
+                               finite_adjust);
+
+        full.pre();
+        full(idx.begin(), idx.end(), col.begin(), col.end());
+        full.post();
+        stream.pre();
+        stream(idx.begin(), idx.begin() + head_cnt,
+               col.begin(), col.begin() + head_cnt);
+        stream.post();
+        for (std::size_t i = head_cnt; i < item_cnt; ++i)
+            assert((stream.update(idx[i], col[i]) == full.get_result()[i]));
+        assert(same(stream.get_result(), full.get_result()));
+
+        // Streaming from the start gives the same result too
+        //
+        ewm_v<double>   scratch(exponential_decay_spec::span, 10,
+                                finite_adjust);
+
+        scratch.pre();
+        for (std::size_t i = 0; i < item_cnt; ++i)
+            scratch.update(idx[i], col[i]);
+        assert(same(scratch.get_result(), full.get_result()));
+    }
+
+    rsi_v<double>   rsi_full(return_policy::percentage, 14);
+    rsi_v<double>   rsi_stream(return_policy::percentage, 14);
+
+    rsi_full.pre();
+    rsi_full(idx.begin(), idx.end(), close.begin(), close.end());
+    rsi_full.post();
+    rsi_stream.pre();
+    rsi_stream(idx.begin(), idx.begin() + head_cnt,
+               close.begin(), close.begin() + head_cnt);
+    rsi_stream.post();
+    for (std::size_t i = head_cnt; i < item_cnt; ++i)
+        rsi_stream.update(idx[i], close[i]);
+    assert(same(rsi_stream.get_result(), rsi_full.get_result()));
+
+    // A column too short for a result, streamed past that point, and a
+    // stream from the start follow the visit
+    //
+    for (std::size_t n = 1; n < 24; ++n)  {
+        rsi_v<double>   rsi_short(return_policy::percentage, 14);
+        rsi_v<double>   rsi_scratch(return_policy::percentage, 14);
+        rsi_v<double>   rsi_n(return_policy::percentage, 14);
+
+        rsi_short.pre();
+        rsi_short(idx.begin(), idx.begin() + 16,
+                  close.begin(), close.begin() + 16);
+        rsi_short.post();
+        for (std::size_t i = 16; i < n; ++i)
+            rsi_short.update(idx[i], close[i]);
+        rsi_scratch.pre();
+        for (std::size_t i = 0; i < n; ++i)
+            rsi_scratch.update(idx[i], close[i]);
+        rsi_n.pre();
+        rsi_n(idx.begin(), idx.begin() + n, close.begin(), close.begin() + n);
+        rsi_n.post();
+
+        assert(rsi_n.get_result().size() == (n > 17 ? n - 13 : 0));
+        assert(same(rsi_scratch.get_result(), rsi_n.get_result()));
+        if (n >= 16)
+            assert(same(rsi_short.get_result(), rsi_n.get_result()));
+    }
+
+    macd_v<double>  macd_full(12, 26, 9);
+    macd_v<double>  macd_stream(12, 26, 9);
+
+    macd_full.pre();
+    macd_full(idx.begin(), idx.end(), close.begin(), close.end());
+    macd_full.post();
+    macd_stream.pre();
+    macd_stream(idx.begin(), idx.begin() + head_cnt,
+                close.begin(), close.begin() + head_cnt);
+    macd_stream.post();
+
+    // The state is saved as bytes and restored into another visitor
+    //
+    const auto      state = macd_stream.get_stream_state();
+    unsigned char   bytes[sizeof(state)];
+    decltype(macd_stream.get_stream_state())    restored;
+
+    std::memcpy(bytes, &state, sizeof(state));
+    std::memcpy(&restored, bytes, sizeof(state));
+
+    macd_v<double>  macd_restored(12, 26, 9);
+
+    macd_restored.pre();
+    macd_restored.set_stream_state(restored);
+    for (std::size_t i = head_cnt; i < item_cnt; ++i)  {
+        const double    line = macd_stream.update(idx[i], close[i]);
+
+        assert(line == macd_restored.update(idx[i], close[i]));
+        assert(line == macd_full.get_macd_line()[i]);
+    }
+    assert(same(macd_stream.get_macd_line(), macd_full.get_macd_line()));
+    assert(same(macd_stream.get_signal_line(), macd_full.get_signal_line()));
+    assert(same(macd_stream.get_macd_histogram(),
+                macd_full.get_macd_histogram()));
+
+    psar_v<double>  psar_full;
+    psar_v<double>  psar_stream;
+
+    psar_full.pre();
+    psar_full(idx.begin(), idx.end(),
+              low.begin(), low.end(),
+              high.begin(), high.end(),
+              close.begin(), close.end());
+    psar_full.post();
+    psar_stream.pre();
+    psar_stream(idx.begin(), idx.begin() + head_cnt,
+                low.begin(), low.begin() + head_cnt,
+                high.begin(), high.begin() + head_cnt,
+                close.begin(), close.begin() + head_cnt);
+    psar_stream.post();
+    for (std::size_t i = head_cnt; i < item_cnt; ++i)
+        assert((psar_stream.update(idx[i], low[i], high[i], close[i]) ==
+                psar_full.get_result()[i]));
+    assert(psar_stream.get_result() == psar_full.get_result());
+    assert(same(psar_stream.get_longs(), psar_full.get_longs()));
+    assert(same(psar_stream.get_shorts(), psar_full.get_shorts()));
+    assert(same(psar_stream.get_acceleration_factors(),
+                psar_full.get_acceleration_factors()));
+
+    psar_v<double>  psar_scratch;
+
+    psar_scratch.pre();
+    for (std::size_t i = 0; i < item_cnt; ++i)
+        psar_scratch.update(idx[i], low[i], high[i], close[i]);
+    assert(psar_scratch.get_result() == psar_full.get_result());
+    assert(same(psar_scratch.get_longs(), psar_full.get_longs()));
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_subscribe()  {
+
+    std::cout << "\nTesting subscribe( ) ..." << std::endl;
+
+    constexpr std::size_t   item_cnt = 500;
+    constexpr std::size_t   head_cnt = 300;
+    StlVecType<double>      close(item_cnt);
+    StlVecType<double>      low(item_cnt);
+    StlVecType<double>      high(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        close[i] = 100.0 + double((i * 7919) % 1013) * 0.01 +
+                   10.0 * std::sin(double(i) / 20.0);
+        low[i] = close[i] - double(i % 7) * 0.1 - 0.5;
+        high[i] = close[i] + double(i % 5) * 0.1 + 0.5;
+    }
+
+    MyDataFrame df;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, head_cnt, 1),
+                 std::make_pair("close",
+                                StlVecType<double>(close.begin(),
+                                                   close.begin() + head_cnt)),
+                 std::make_pair("low",
+                                StlVecType<double>(low.begin(),
+                                                   low.begin() + head_cnt)),
+                 std::make_pair("high",
+                                StlVecType<double>(high.begin(),
+                                                   high.begin() + head_cnt)));
+
+    ewm_v<double>   ewm(exponential_decay_spec::span, 10, true);
+    rsi_v<double>   rsi(return_policy::percentage, 14);
+    macd_v<double>  macd(12, 26, 9);
+    psar_v<double>  psar;
+
+    df.subscribe<double>("close", ewm);
+    df.subscribe<double>("close", rsi);
+    df.subscribe<double>("close", macd);
+    df.subscribe<double, double, double>("low", "high", "close", psar);
+    assert(ewm.get_result().size() == head_cnt);
+
+    for (unsigned long i = head_cnt; i < item_cnt; ++i)
+        df.append_row(&i,
+                      std::make_pair("close", close[i]),
+                      std::make_pair("low", low[i]),
+                      std::make_pair("high", high[i]));
+
+    const auto  same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            if (! (lhs[i] == rhs[i] ||
+                   (std::isnan(lhs[i]) && std::isnan(rhs[i]))))
+                return (false);
+        return (true);
+    };
+
+    // The subscribed visitors match a visit of all the rows
+    //
+    const auto  check = [&]() -> void  {
+        ewm_v<double>   ewm2(exponential_decay_spec::span, 10, true);
+        rsi_v<double>   rsi2(return_policy::percentage, 14);
+        macd_v<double>  macd2(12, 26, 9);
+        psar_v<double>  psar2;
+
+        df.single_act_visit<double>("close", ewm2);
+        df.single_act_visit<double>("close", rsi2);
+        df.single_act_visit<double>("close", macd2);
+        df.single_act_visit<double, double, double>("low", "high", "close",
+                                                    psar2);
+        assert(same(ewm.get_result(), ewm2.get_result()));
+        assert(same(rsi.get_result(), rsi2.get_result()));
+        assert(same(macd.get_macd_line(), macd2.get_macd_line()));
+        assert(same(macd.get_signal_line(), macd2.get_signal_line()));
+        assert(same(macd.get_macd_histogram(), macd2.get_macd_histogram()));
+        assert(psar.get_result() == psar2.get_result());
+        assert(same(psar.get_longs(), psar2.get_longs()));
+    };
+
+    assert(ewm.get_result().size() == item_cnt);
+    check();
+
+    // Other changes recompute the visitors
+    //
+    df.get_column<double>("close")[10] = 150.0;
+    df.touch_column("close");
+    check();
+    df.remove_data_by_loc<double>({ 0, 50 });
+    assert(ewm.get_result().size() == item_cnt - 50);
+    check();
+
+    // Removing a column drops its subscriptions
+    //
+    df.remove_column("low");
+    assert(df.unsubscribe(psar) == 0);
+    assert(df.unsubscribe(ewm) == 1);
+
+    const std::size_t   ewm_s = ewm.get_result().size();
+    unsigned long       idx_val = item_cnt;
+
+    df.append_row(&idx_val,
+                  std::make_pair("close", 101.0),
+                  std::make_pair("high", 102.0));
+    assert(ewm.get_result().size() == ewm_s);
+    assert(macd.get_macd_line().size() == ewm_s + 1);
+    assert(df.unsubscribe(rsi) == 1);
+    assert(df.unsubscribe(macd) == 1);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_RingDataFrame()  {
+
+    std::cout << "\nTesting RingDataFrame{  } ..." << std::endl;
+
+    using RingDF = RingDataFrame<unsigned long, 256>;
+
+    constexpr std::size_t   cap = 100;
+    RingDF                  rdf(cap);
+
+    rdf.create_column<double>("close");
+    rdf.create_column<double>("volume");
+    assert(rdf.empty() && rdf.capacity() == cap && rdf.col_num() == 2);
+
+    for (unsigned long i = 0; i < 250; ++i)  {
+        const double    close =
+            100.0 + double((i * 7919) % 1013) * 0.01 +
+            10.0 * std::sin(double(i) / 20.0);
+
+        if (i % 10 == 0)
+            rdf.append_row(i, std::make_pair("close", close));
+        else
+            rdf.append_row(i,
+                           std::make_pair("close", close),
+                           std::make_pair("volume", double(i * 10)));
+    }
+
+    const auto  idx = rdf.get_index();
+    const auto  volume = rdf.get_column<double>("volume");
+
+    assert(rdf.full() && rdf.size() == cap);
+    assert(idx.front() == 150 && idx.back() == 249);
+    assert(idx.is_wrapped());
+    assert(std::isnan(volume[0]) && volume[1] == 1510.0);
+    assert(volume.back() == 2490.0);
+    assert(*(volume.begin() + 55) == 2050.0);
+    assert(volume.end() - volume.begin() == long(cap));
+
+    // The two segments hold the rows in order
+    //
+    const auto  segs = idx.segments();
+
+    assert(segs.first.size() == 50 && segs.second.size() == 50);
+    assert(segs.first.front() == 150 && segs.first.back() == 199);
+    assert(segs.second.front() == 200 && segs.second.back() == 249);
+
+    // Visitors across the wraparound see what they see on the linear copy
+    //
+    const MyDataFrame   df = rdf.to_dataframe();
+
+    assert(df.get_index().size() == cap);
+    assert(df.get_index()[0] == 150 && df.get_index()[99] == 249);
+
+    const auto  same = [](const auto &lhs, const auto &rhs) -> bool  {
+        if (lhs.size() != rhs.size())  return (false);
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+            if (! (lhs[i] == rhs[i] ||
+                   (std::isnan(lhs[i]) && std::isnan(rhs[i]))))
+                return (false);
+        return (true);
+    };
+
+    MeanVisitor<double>     mean;
+    MeanVisitor<double>     mean2;
+
+    rdf.single_act_visit<double>("close", mean);
+    df.single_act_visit<double>("close", mean2);
+    assert(mean.get_result() == mean2.get_result());
+
+    ewm_v<double>   ewm(exponential_decay_spec::span, 10, true);
+    ewm_v<double>   ewm2(exponential_decay_spec::span, 10, true);
+
+    rdf.single_act_visit<double>("close", ewm);
+    df.single_act_visit<double>("close", ewm2);
+    assert(same(ewm.get_result(), ewm2.get_result()));
+
+    ewm.get_result().clear();
+    ewm2.get_result().clear();
+    rdf.single_act_visit<double>("close", ewm, true);
+    df.single_act_visit<double>("close", ewm2, true);
+    assert(same(ewm.get_result(), ewm2.get_result()));
+
+    BollingerBand<double>   bband(2, 2, 14, false);
+    BollingerBand<double>   bband2(2, 2, 14, false);
+
+    rdf.single_act_visit<double>("close", bband);
+    df.single_act_visit<double>("close", bband2);
+    assert(same(bband.get_upper_band_to_raw(),
+                bband2.get_upper_band_to_raw()));
+
+    CorrVisitor<double>     corr;
+    CorrVisitor<double>     corr2;
+
+    rdf.single_act_visit<double, double>("close", "volume", corr);
+    df.single_act_visit<double, double>("close", "volume", corr2);
+    assert(corr.get_result() == corr2.get_result() ||
+           (std::isnan(corr.get_result()) && std::isnan(corr2.get_result())));
+
+    // Evicting moves nothing
+    //
+    assert(rdf.evict(30) == 30);
+    assert(rdf.size() == 70 && rdf.get_index().front() == 180);
+    assert(rdf.get_index().segments().first.size() == 20);
+    assert(rdf.get_index().segments().second.front() == 200);
+    rdf.append_row(250ul, std::make_pair("volume", 2500.0));
+    assert(rdf.size() == 71 && rdf.get_index().back() == 250);
+    assert(std::isnan(rdf.get_column<double>("close").back()));
+
+    // Accessing a column as the wrong type throws, instead of reading or
+    // writing past its buffer
+    //
+    try  {
+        rdf.append_row(251ul, std::make_pair("close", 1));
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+    try  {
+        rdf.get_column<float>("volume");
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+    assert(rdf.size() == 71);
+
+    rdf.clear();
+    assert(rdf.empty() && rdf.col_num() == 2);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_get_appender()  {
+
+    std::cout << "\nTesting get_appender( ) ..." << std::endl;
+
+    constexpr std::size_t   head_cnt = 50;
+    constexpr std::size_t   item_cnt = 20000;
+    StlVecType<double>      price(item_cnt);
+    StlVecType<long>        size(item_cnt);
+
+    for (std::size_t i = 0; i < item_cnt; ++i)  {
+        price[i] = 100.0 + double((i * 7919) % 1013) * 0.01;
+        size[i] = long((i * 31) % 500) + 1;
+    }
+
+    MyDataFrame df;
+    MyDataFrame df2;
+
+    df.load_data(MyDataFrame::gen_sequence_index(0, head_cnt, 1),
+                 std::make_pair("price",
+                                StlVecType<double>(price.begin(),
+                                                   price.begin() + head_cnt)));
+    df2 = df;
+
+    ewm_v<double>   ewm(exponential_decay_spec::span, 10, true);
+
+    df.subscribe<double>("price", ewm);
+
+    {
+        // The size column does not exist. It is created and padded
+        //
+        auto    appender =
+            df.get_appender<double, long>({ "price", "size" }, 1000);
+
+        assert(df.get_column<long>("size").size() == head_cnt);
+
+        for (unsigned long i = head_cnt; i < item_cnt / 2; ++i)
+            appender.append(i, price[i], size[i]);
+        assert(ewm.get_result().size() == head_cnt);
+        assert(appender.flush() == item_cnt / 2 - head_cnt);
+        assert(ewm.get_result().size() == item_cnt / 2);
+
+        // The rest are appended as one batch. The destructor flushes
+        //
+        const auto  idx = MyDataFrame::gen_sequence_index(item_cnt / 2,
+                                                          item_cnt, 1);
+
+        appender.append(idx.size(), idx.data(),
+                        price.data() + item_cnt / 2,
+                        size.data() + item_cnt / 2);
+    }
+
+    for (unsigned long i = head_cnt; i < item_cnt; ++i)
+        df2.append_row(&i, std::make_pair("price", price[i]));
+
+    assert(df.get_index().size() == item_cnt);
+    assert(df.get_index() == df2.get_index());
+    assert(df.get_column<double>("price") == df2.get_column<double>("price"));
+    assert(df.get_column<long>("size").size() == item_cnt);
+    assert(df.get_column<long>("size")[head_cnt - 1] == 0);
+    assert(df.get_column<long>("size")[head_cnt] == size[head_cnt]);
+    assert(df.get_column<long>("size").back() == size.back());
+    assert(ewm.get_result().size() == item_cnt);
+
+    // The same column cannot be bound twice
+    //
+    try  {
+        auto    appender = df.get_appender<double, double>({ "price",
+                                                             "price" });
+
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+
+    // A column that is longer than the index cannot be bound
+    //
+    df.get_column<long>("size").push_back(1);
+    try  {
+        auto    appender = df.get_appender<long>({ "size" });
+
+        assert(false);
+    }
+    catch (const InconsistentData &)  {  }
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_LiveDataFrame()  {
+
+    std::cout << "\nTesting LiveDataFrame{  } ..." << std::endl;
+
+    using LiveDF = LiveDataFrame<unsigned long, 256>;
+
+    constexpr std::size_t   item_cnt = 20000;
+    LiveDF                  ldf(64);
+
+    ldf.create_column<double>("close");
+    ldf.create_column<long>("volume");
+
+    // One writer appends, while a few readers visit snapshots
+    //
+    std::atomic<bool>   done { false };
+    auto                writer = std::async(std::launch::async, [&]()  {
+        for (unsigned long i = 0; i < item_cnt; ++i)  {
+            if (i % 3 == 0)
+                ldf.append_row(i, std::make_pair("close", double(i)));
+            else
+                ldf.append_row(i,
+                               std::make_pair("close", double(i)),
+                               std::make_pair("volume", long(i * 10)));
+        }
+        done = true;
+    });
+    const auto          reader = [&]() -> std::size_t  {
+        std::size_t last_size = 0;
+        std::size_t snap_cnt = 0;
+
+        do  {
+            const auto  snap = ldf.snapshot();
+            const auto  n = snap.size();
+
+            assert(n >= last_size);
+            last_size = n;
+            snap_cnt += 1;
+            std::this_thread::yield();
+            if (n == 0)  continue;
+
+            const auto  idx = snap.get_index();
+            const auto  volume = snap.get_column<long>("volume");
+
+            assert(idx.size() == n && volume.size() == n);
+            assert(idx.front() == 0 && idx.back() == n - 1);
+            assert(volume[n - 1] == ((n - 1) % 3 == 0 ? 0 : long(n - 1) * 10));
+
+            MeanVisitor<double> mean;
+
+            snap.single_act_visit<double>("close", mean);
+            assert(mean.get_result() == double(n - 1) / 2.0);
+        } while (! done && snap_cnt < 500);
+        return (snap_cnt);
+    };
+    auto                reader1 = std::async(std::launch::async, reader);
+    auto                reader2 = std::async(std::launch::async, reader);
+
+    writer.get();
+    assert(reader1.get() > 0);
+    assert(reader2.get() > 0);
+
+    // All the generations are retired, since no snapshot is held
+    //
+    ldf.reclaim();
+    assert(ldf.retired_count() == 0);
+    assert(ldf.size() == item_cnt && ldf.capacity() >= item_cnt);
+
+    const auto  snap = ldf.snapshot();
+    const auto  df = snap.to_dataframe();
+
+    assert(df.get_index().size() == item_cnt);
+    assert(df.get_column<double>("close")[777] == 777.0);
+    assert(df.get_column<long>("volume")[778] == 7780);
+
+    // A held snapshot keeps its generation after the writer moves on
+    //
+    const std::size_t   cap = ldf.capacity();
+
+    for (unsigned long i = item_cnt; i <= cap; ++i)
+        ldf.append_row(i, std::make_pair("close", double(i)));
+    assert(ldf.retired_count() == 1 && ldf.capacity() == cap * 2);
+    assert(snap.size() == item_cnt);
+    assert(snap.get_column<double>("close").back() == double(item_cnt - 1));
+
+    CorrVisitor<double> corr;
+
+    snap.single_act_visit<double, double>("close", "close", corr);
+    assert(std::abs(corr.get_result() - 1.0) < 0.0000001);
+
+    // Accessing a column as the wrong type throws, instead of reading or
+    // writing past its buffer
+    //
+    try  {
+        ldf.append_row(cap + 1, std::make_pair("volume", 1.0));
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+    try  {
+        snap.get_column<float>("close");
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+    try  {
+        ldf.create_column<int>("close");
+        assert(false);
+    }
+    catch (const DataFrameError &)  {  }
+    assert(ldf.size() == cap + 1);
+}
+
+// -----------------------------------------------------------------------------
+
+static void test_SpinLock_stats()  {
+
+    std::cout << "\nTesting SpinLock{  } stats ..." << std::endl;
+
+    constexpr std::size_t   thread_cnt = 4;
+    constexpr std::size_t   iter_cnt = 20000;
+
+    // The second lock parks waiters without spinning
+    //
+    for (const unsigned int max_spin : { 1024U, 0U })  {
+        SpinLock    lock (max_spin);
+        std::size_t counter = 0;
+
+        std::vector<std::thread>    thr_vec;
+
+        for (std::size_t t = 0; t < thread_cnt; ++t)
+            thr_vec.push_back(std::thread([&lock, &counter]()  {
+                for (std::size_t i = 0; i < iter_cnt; ++i)  {
+                    const SpinGuard guard (&lock);
+                    const SpinGuard guard2 (&lock);  // Recursive
+
+                    counter += 1;
+                }
+            }));
+        for (auto &thr : thr_vec)  thr.join();
+
+        const auto  stats = lock.get_stats();
+
+        assert(counter == thread_cnt * iter_cnt);
+        assert(stats.acquisitions == thread_cnt * iter_cnt);
+        assert(stats.contended <= stats.acquisitions);
+        assert(stats.parks == 0 || stats.contended > 0);
+        assert(stats.contended > 0 || stats.wait_nanosec == 0);
+
+        // A held lock cannot be taken by another thread
+        //
+        lock.reset_stats();
+        lock.lock();
+        assert(lock.try_lock());
+        assert(! std::async(std::launch::async,
+                            [&lock]() -> bool  { return (lock.try_lock()); })
+                     .get());
+        lock.unlock();
+        lock.unlock();
+        assert(std::async(std::launch::async,
+                          [&lock]() -> bool  {
+                              const bool    ret = lock.try_lock();
+
+                              if (ret)  lock.unlock();
+                              return (ret);
+                          }).get());
+        assert(lock.get_stats().acquisitions == 2);
+        assert(lock.get_stats().contended == 0);
+    }
+
+    // DataFrame keeps using it through set_lock()
+    //
+    SpinLock    lock;
+
+    MyDataFrame::set_lock(&lock);
+
+    MyDataFrame df;
+
+    df.load_index(MyDataFrame::gen_sequence_index(0, 100, 1));
+    df.load_column("col", StlVecType<double>(100, 1.0));
+    assert(df.get_column<double>("col").size() == 100);
+    assert(lock.get_stats().acquisitions > 0);
+    MyDataFrame::remove_lock();
+}
+
+// -----------------------------------------------------------------------------
+
 int main(int, char *[]) {
 
     test_groupby_edge();
@@ -1438,6 +3938,31 @@ int main(int, char *[]) {
     test_FixedAutoCorrVisitor();
     test_RVIVisitor();
     test_LinregMovingMeanVisitor();
+    test_groupby_sorted();
+    test_groupby_parallel();
+    test_hash_join();
+    test_sorted_join();
+    test_join_asof();
+    test_multi_column_join();
+    test_semi_anti_join();
+    test_join_by_interval();
+    test_join_rows();
+    test_sel_parallel();
+    test_get_data_by_pred();
+    test_query();
+    test_multi_visit_fused();
+    test_describe_stats();
+    test_cum_scan_parallel();
+    test_ewm_parallel();
+    test_single_act_visit_panel();
+    test_single_act_visit_grouped();
+    test_derived_cache();
+    test_streaming_update();
+    test_subscribe();
+    test_RingDataFrame();
+    test_get_appender();
+    test_LiveDataFrame();
+    test_SpinLock_stats();
 
     return (0);
 }